@@ -1,71 +1,69 @@
 #include "BusService.h"
+#include "HttpPool.h"
+#include "NetStats.h"
+#include "Translit.h"
 #include <algorithm> // For sort
 
-// Helper to remove Latin chars for display compatibility
-String sanitize(String input) {
-  input.replace("á", "a");
-  input.replace("à", "a");
-  input.replace("Á", "A");
-  input.replace("À", "A");
-  input.replace("é", "e");
-  input.replace("è", "e");
-  input.replace("É", "E");
-  input.replace("È", "E");
-  input.replace("í", "i");
-  input.replace("Í", "I");
-  input.replace("ï", "i");
-  input.replace("Ï", "I");
-  input.replace("ó", "o");
-  input.replace("ò", "o");
-  input.replace("Ó", "O");
-  input.replace("Ò", "O");
-  input.replace("ú", "u");
-  input.replace("ù", "u");
-  input.replace("ü", "u");
-  input.replace("Ú", "U");
-  input.replace("Ü", "U");
-  input.replace("ñ", "n");
-  input.replace("Ñ", "N");
-  input.replace("ç", "c");
-  input.replace("Ç", "C");
-  input.replace("·", ".");
-  return input;
-}
-
 // TMB API: https://developer.tmb.cat/api-docs/v1/transit
 // Endpoint: /ibus/stops/{stopCode}
 
+// Only the fields we read from the (large) parades payload
+static void buildParadesFilter(JsonDocument &filter) {
+  filter["timestamp"] = true;
+  JsonObject parada = filter["parades"][0].to<JsonObject>();
+  parada["nom_parada"] = true;
+  JsonObject linia = parada["linies_trajectes"][0].to<JsonObject>();
+  linia["nom_linia"] = true;
+  linia["desti_trajecte"] = true;
+  linia["propers_busos"][0]["temps_arribada"] = true;
+  NetStats::finishFilter(filter);
+}
+
 #include <WiFiClientSecure.h>
 
+String BusService::baseUrl;
+
+void BusService::formatEta(int seconds, char *out, size_t len) {
+  int mins = etaMinutes(seconds);
+  if (mins == 0)
+    strlcpy(out, "Prop", len);
+  else
+    snprintf(out, len, "%d min", mins);
+}
+
 bool BusService::updateBusTimes(BusData &data, String stopCode, String appId,
                                 String appKey) {
   if (WiFi.status() != WL_CONNECTED)
     return false;
 
-  WiFiClientSecure client;
-  client.setInsecure(); // Skip SSL verification
-
-  HTTPClient http;
-
   // Use the combined itransit endpoint
-  String url = "https://api.tmb.cat/v1/itransit/bus/parades/" + stopCode +
-               "?app_id=" + appId + "&app_key=" + appKey;
+  String url =
+      (baseUrl.isEmpty() ? String("https://api.tmb.cat") : baseUrl) +
+      "/v1/itransit/bus/parades/" + stopCode + "?app_id=" + appId +
+      "&app_key=" + appKey;
 
   // Serial.println("Fetching Combined Bus Data: " + url);
-  http.begin(client, url);
-  http.setConnectTimeout(5000);
-  http.setTimeout(5000);
+  HTTPClient *pooled = HttpPool::begin(url, EP_TMB_PARADES); // 5s timeout
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
 
-  int httpResponseCode = http.GET();
+  int httpResponseCode = HttpPool::get(&http);
   if (httpResponseCode > 0) {
     // Use Stream to save RAM
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, http.getStream());
+    JsonDocument filter;
+    buildParadesFilter(filter);
+    CountingAllocator alloc;
+    JsonDocument doc(&alloc);
+    DeserializationError error =
+        deserializeJson(doc, HttpPool::stream(&http),
+                        DeserializationOption::Filter(filter));
+    NetStats::recordDoc(EP_TMB_PARADES, alloc.peak());
 
     if (error) {
       Serial.print(F("deserializeJson() failed: "));
       Serial.println(error.f_str());
-      http.end();
+      HttpPool::release(&http);
       return false;
     }
 
@@ -77,14 +75,14 @@ bool BusService::updateBusTimes(BusData &data, String stopCode, String appId,
       Serial.println("No parades found. (Valid Response)");
       data.arrivals.clear();
       data.stopCode = stopCode;
-      http.end();
+      HttpPool::release(&http);
       return true; // Return TRUE so UI updates to show "No Buses"
     }
 
     JsonObject p = parades[0];
     String stopName = p["nom_parada"].as<String>();
     if (stopName.length() > 0) {
-      data.stopName = sanitize(stopName);
+      data.stopName = Translit::forDisplay(stopName); // Once, at ingest
       // Serial.println("Stop Name (Updated): " + data.stopName);
     }
 
@@ -96,7 +94,7 @@ bool BusService::updateBusTimes(BusData &data, String stopCode, String appId,
       String lineName = l["nom_linia"].as<String>();
       // Removed line filter logic
 
-      String destination = sanitize(l["desti_trajecte"].as<String>());
+      String destination = Translit::forDisplay(l["desti_trajecte"].as<String>());
       JsonArray buses = l["propers_busos"];
 
       for (JsonObject b : buses) {
@@ -114,11 +112,9 @@ bool BusService::updateBusTimes(BusData &data, String stopCode, String appId,
         arr.seconds = diffSeconds;
 
         // Create text representation
-        if (diffSeconds < 60) {
-          arr.text = "Prop";
-        } else {
-          arr.text = String(diffSeconds / 60) + " min";
-        }
+        char eta[16];
+        formatEta(diffSeconds, eta, sizeof(eta));
+        arr.text = eta;
 
         data.arrivals.push_back(arr);
       }
@@ -130,13 +126,13 @@ bool BusService::updateBusTimes(BusData &data, String stopCode, String appId,
                 return a.seconds < b.seconds;
               });
 
-    http.end();
+    HttpPool::release(&http);
     // Serial.println("DEBUG: Bus Data Updated (Returning True)");
     return true;
   } else {
     Serial.print("Error code: ");
     Serial.println(httpResponseCode);
-    http.end();
+    HttpPool::release(&http);
     return false;
   }
 }
@@ -5,18 +5,21 @@
 #include <HTTPClient.h>
 #include <vector>
 
+#define BUS_MAX_STOPS 5 // Configured stops kept (NetworkManager::getBusStops)
+
 struct BusArrival {
   String line;
   String destination;
-  String text; // e.g. "5 min"
-  int seconds; // Time in seconds
+  String text; // e.g. "5 min", at fetch time (see BusService::formatEta)
+  int seconds; // Time in seconds, at fetch time
+  uint8_t stop = 0; // DepartureBoard: index of the stop it arrives at
 };
 
 struct BusData {
   String stopName;
   String stopCode;
-  std::vector<BusArrival> arrivals;
-  uint32_t lastUpdate = 0;
+  std::vector<BusArrival> arrivals; // Sorted by seconds
+  uint32_t lastUpdate = 0; // millis() of the response; 0 = from flash
 };
 
 class BusService {
@@ -26,4 +29,25 @@ public:
   // lineFilter: e.g. "V15". If empty, returns all lines.
   static bool updateBusTimes(BusData &data, String stopCode, String appId,
                              String appKey);
+
+  // Seconds left now, counted down locally from the response time (as
+  // fetched for data from flash, which has no time reference)
+  static int secondsLeft(const BusArrival &arr, const BusData &data,
+                         uint32_t nowMs) {
+    if (data.lastUpdate == 0)
+      return arr.seconds;
+    return arr.seconds - (int)((nowMs - data.lastUpdate) / 1000);
+  }
+
+  // "Prop" under a minute, else "N min"; the minute is what the UI shows
+  static int etaMinutes(int seconds) {
+    return seconds < 60 ? 0 : seconds / 60;
+  }
+  static void formatEta(int seconds, char *out, size_t len);
+
+  // TMB origin override for tools/replay_server.py (empty: real API)
+  static void setBaseUrl(const String &url) { baseUrl = url; }
+
+private:
+  static String baseUrl;
 };
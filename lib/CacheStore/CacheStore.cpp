@@ -0,0 +1,259 @@
+#include "CacheStore.h"
+#include <LittleFS.h>
+
+static const char *CACHE_PATH = "/cache.bin";
+static const char *CACHE_TMP_PATH = "/cache.tmp";
+static const uint32_t CACHE_MAGIC = 0x53434357; // "WCCS"
+
+bool CacheStore::mounted = false;
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t *p, size_t n) {
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+// --- Serialization helpers (little-endian, CRC over everything written) ---
+
+namespace {
+
+struct Writer {
+  File &file;
+  uint32_t crc = 0;
+  bool ok = true;
+
+  explicit Writer(File &f) : file(f) {}
+
+  void bytes(const void *p, size_t n) {
+    if (file.write((const uint8_t *)p, n) != n)
+      ok = false;
+    crc = crc32Update(crc, (const uint8_t *)p, n);
+  }
+  void u8(uint8_t v) { bytes(&v, 1); }
+  void u16(uint16_t v) { bytes(&v, 2); }
+  void u32(uint32_t v) { bytes(&v, 4); }
+  void f32(float v) { bytes(&v, 4); }
+  void str(const String &s) {
+    uint8_t len = s.length() > 255 ? 255 : s.length();
+    u8(len);
+    bytes(s.c_str(), len);
+  }
+};
+
+struct Reader {
+  File &file;
+  uint32_t crc = 0;
+  bool ok = true;
+
+  explicit Reader(File &f) : file(f) {}
+
+  void bytes(void *p, size_t n) {
+    if (!ok || file.read((uint8_t *)p, n) != n) {
+      ok = false;
+      memset(p, 0, n);
+      return;
+    }
+    crc = crc32Update(crc, (const uint8_t *)p, n);
+  }
+  uint8_t u8() {
+    uint8_t v;
+    bytes(&v, 1);
+    return v;
+  }
+  uint16_t u16() {
+    uint16_t v;
+    bytes(&v, 2);
+    return v;
+  }
+  uint32_t u32() {
+    uint32_t v;
+    bytes(&v, 4);
+    return v;
+  }
+  float f32() {
+    float v;
+    bytes(&v, 4);
+    return v;
+  }
+  String str() {
+    char buf[256];
+    uint8_t len = u8();
+    bytes(buf, len);
+    buf[ok ? len : 0] = '\0';
+    return String(buf);
+  }
+};
+
+} // namespace
+
+bool CacheStore::begin() {
+  if (mounted)
+    return true;
+  uint32_t start = millis();
+  mounted = LittleFS.begin(true); // Format if the partition is blank
+  Serial.printf("CACHE: LittleFS %s in %u ms\n", mounted ? "mounted" : "FAILED",
+                (unsigned)(millis() - start));
+  return mounted;
+}
+
+bool CacheStore::save(const std::vector<CityWeatherCache> &cities,
+                      const std::vector<BusStopCache> &stops,
+                      const std::vector<StockItem> &stocks) {
+  if (!begin())
+    return false;
+  uint32_t start = millis();
+
+  File f = LittleFS.open(CACHE_TMP_PATH, "w");
+  if (!f) {
+    Serial.println("CACHE: Cannot open temp file");
+    return false;
+  }
+
+  Writer w(f);
+  w.u32(CACHE_MAGIC);
+  w.u16(CACHE_VERSION);
+  w.u16(sizeof(WeatherData)); // Layout guard for the raw struct below
+
+  w.u8(cities.size());
+  for (const CityWeatherCache &c : cities) {
+    w.str(c.cityName);
+    w.u8(c.hasData);
+    if (c.hasData)
+      w.bytes(&c.data, sizeof(WeatherData)); // POD
+  }
+
+  w.u8(stops.size());
+  for (const BusStopCache &s : stops) {
+    w.str(s.id);
+    w.str(s.data.stopName);
+    w.str(s.data.stopCode);
+    uint8_t n = s.data.arrivals.size() > 255 ? 255 : s.data.arrivals.size();
+    w.u8(n);
+    for (uint8_t i = 0; i < n; i++) {
+      const BusArrival &a = s.data.arrivals[i];
+      w.str(a.line);
+      w.str(a.destination);
+      w.str(a.text);
+      w.u32((uint32_t)a.seconds);
+    }
+  }
+
+  w.u8(stocks.size());
+  for (const StockItem &s : stocks) {
+    w.str(s.symbol);
+    w.f32(s.price);
+    w.f32(s.changePercent);
+    w.u8(s.isValid);
+  }
+
+  uint32_t crc = w.crc;
+  w.u32(crc);
+  size_t size = f.size();
+  f.close();
+
+  if (!w.ok) {
+    Serial.println("CACHE: Write failed (flash full?)");
+    LittleFS.remove(CACHE_TMP_PATH);
+    return false;
+  }
+  LittleFS.remove(CACHE_PATH);
+  if (!LittleFS.rename(CACHE_TMP_PATH, CACHE_PATH)) {
+    Serial.println("CACHE: Rename failed");
+    return false;
+  }
+  Serial.printf("CACHE: Saved %u B in %u ms\n", (unsigned)size,
+                (unsigned)(millis() - start));
+  return true;
+}
+
+bool CacheStore::load(std::vector<CityWeatherCache> &cities,
+                      std::vector<BusStopCache> &stops,
+                      std::vector<StockItem> &stocks) {
+  if (!begin() || !LittleFS.exists(CACHE_PATH))
+    return false;
+  uint32_t start = millis();
+
+  File f = LittleFS.open(CACHE_PATH, "r");
+  if (!f)
+    return false;
+
+  Reader r(f);
+  if (r.u32() != CACHE_MAGIC || r.u16() != CACHE_VERSION ||
+      r.u16() != sizeof(WeatherData)) {
+    Serial.println("CACHE: Snapshot from another version, ignored");
+    f.close();
+    return false;
+  }
+
+  // Parse everything into temporaries, commit only if the CRC matches
+  std::vector<CityWeatherCache> savedCities(r.u8());
+  for (CityWeatherCache &c : savedCities) {
+    c.cityName = r.str();
+    c.hasData = r.u8();
+    c.lastUpdate = 0;
+    if (c.hasData)
+      r.bytes(&c.data, sizeof(WeatherData));
+  }
+
+  std::vector<BusStopCache> savedStops(r.u8());
+  for (BusStopCache &s : savedStops) {
+    s.id = r.str();
+    s.data.stopName = r.str();
+    s.data.stopCode = r.str();
+    s.data.arrivals.resize(r.u8());
+    for (BusArrival &a : s.data.arrivals) {
+      a.line = r.str();
+      a.destination = r.str();
+      a.text = r.str();
+      a.seconds = (int)r.u32();
+    }
+    s.lastUpdate = 0;
+  }
+
+  std::vector<StockItem> savedStocks(r.u8());
+  for (StockItem &s : savedStocks) {
+    s.symbol = r.str();
+    s.price = r.f32();
+    s.changePercent = r.f32();
+    s.isValid = r.u8();
+  }
+
+  uint32_t crc = r.crc;
+  bool valid = r.ok && r.u32() == crc;
+  f.close();
+  if (!valid) {
+    Serial.println("CACHE: Snapshot corrupt, ignored");
+    return false;
+  }
+
+  // Match by configured name/id: the settings may have changed since
+  int hits = 0;
+  for (CityWeatherCache &c : cities) {
+    for (CityWeatherCache &s : savedCities) {
+      if (s.hasData && s.cityName == c.cityName) {
+        c.data = s.data;
+        c.data.lastUpdate = 0; // millis() of a previous boot: stale
+        c.hasData = true;
+        hits++;
+      }
+    }
+  }
+  for (BusStopCache &c : stops) {
+    for (BusStopCache &s : savedStops) {
+      if (s.id == c.id && !s.data.stopCode.isEmpty()) {
+        c.data = s.data;
+        c.data.lastUpdate = 0;
+        hits++;
+      }
+    }
+  }
+  stocks = savedStocks;
+
+  Serial.printf("CACHE: Loaded %d entries + %u stocks in %u ms\n", hits,
+                (unsigned)stocks.size(), (unsigned)(millis() - start));
+  return true;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+#include "DataManager.h"
+
+// Last-known data on LittleFS for instant-on boot.
+// One versioned binary snapshot (/cache.bin) holding the city weather
+// caches, bus stop caches and the stock list. Written to a temp file and
+// renamed, so a power cut mid-write keeps the previous snapshot.
+// Bump CACHE_VERSION whenever a cached struct changes layout.
+#define CACHE_VERSION 1
+
+class CacheStore {
+public:
+  static bool begin(); // Mount LittleFS (formats on first use)
+
+  // Fills entries whose city name / stop id matches the configured ones.
+  // Loaded entries keep lastUpdate = 0 so the views flag them as stale.
+  static bool load(std::vector<CityWeatherCache> &cities,
+                   std::vector<BusStopCache> &stops,
+                   std::vector<StockItem> &stocks);
+
+  static bool save(const std::vector<CityWeatherCache> &cities,
+                   const std::vector<BusStopCache> &stops,
+                   const std::vector<StockItem> &stocks);
+
+private:
+  static bool mounted;
+};
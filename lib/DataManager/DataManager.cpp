@@ -1,31 +1,33 @@
 #include "DataManager.h"
+#include "CacheStore.h"
 #include "GuiController.h"
+#include "HttpPool.h"
 #include "LedController.h"
+#include "NetStats.h"
 #include "NetworkManager.h"
+#include "Translit.h"
 #include <esp_task_wdt.h> // Hardware Watchdog
 
 // Defines
-SemaphoreHandle_t DataManager::dataMutex = NULL;
-
-WeatherData DataManager::weatherData;
-BusData DataManager::busData;
-std::vector<StockItem> DataManager::stockData;
-
-volatile bool DataManager::weatherDataUpdated = false;
-volatile bool DataManager::busDataUpdated = false;
-volatile bool DataManager::stockDataUpdated = false;
+Snapshot<WeatherData> DataManager::weatherSnap;
+Snapshot<BusData> DataManager::busSnap;
+Snapshot<BusData> DataManager::stopSnaps[BUS_MAX_STOPS];
+Snapshot<std::vector<StockItem>> DataManager::stockSnap;
 
 volatile int DataManager::currentUpdatingCityIndex = -1;
 volatile int DataManager::currentUpdatingBusIndex = -1;
 volatile bool DataManager::isUpdatingStock = false;
 volatile uint32_t DataManager::stockLastUpdateTime = 0;
 
-volatile bool DataManager::weatherStatusChanged = false;
-volatile bool DataManager::busStatusChanged = false;
+SpscQueue<DataEvent, 32> DataManager::events;
+volatile uint32_t DataManager::droppedEvents = 0;
+DataManager::TraceEntry DataManager::eventTrace[EVENT_TRACE_LEN];
+uint32_t DataManager::eventTraceCount = 0;
 
 volatile bool DataManager::manualBusTrigger = false;
 volatile bool DataManager::manualWeatherTrigger = false;
 volatile bool DataManager::manualStockTrigger = true;
+volatile bool DataManager::manualRefreshAll = false;
 
 bool DataManager::isWeatherUpdating(int cityIndex) {
   return currentUpdatingCityIndex == cityIndex;
@@ -36,129 +38,139 @@ bool DataManager::isBusUpdating(int busIndex) {
 bool DataManager::isStockUpdating() { return isUpdatingStock; }
 uint32_t DataManager::getStockLastUpdate() { return stockLastUpdateTime; }
 
-bool DataManager::getWeatherStatusChanged() {
-  if (weatherStatusChanged) {
-    weatherStatusChanged = false;
-    return true;
-  }
-  return false;
+void DataManager::postEvent(DataEventType type, DataSource source,
+                            int index) {
+  DataEvent ev = {type, source, (int8_t)index, micros()};
+  if (!events.push(ev))
+    droppedEvents++; // GUI stalled for 32 events; state is still in snapshots
+  GuiController::wake();
 }
 
-bool DataManager::getBusStatusChanged() {
-  if (busStatusChanged) {
-    busStatusChanged = false;
-    return true;
+bool DataManager::pollEvent(DataEvent &out) {
+  if (!events.pop(out))
+    return false;
+  TraceEntry &t = eventTrace[eventTraceCount++ % EVENT_TRACE_LEN];
+  t.event = out;
+  t.consumedUs = micros();
+  return true;
+}
+
+void DataManager::dumpEventTrace() {
+  static const char *types[] = {"started", "ready", "failed", "cached"};
+  static const char *sources[] = {"weather", "bus", "stock"};
+  uint32_t n = eventTraceCount < EVENT_TRACE_LEN ? eventTraceCount
+                                                 : EVENT_TRACE_LEN;
+  Serial.printf("EVENTS: last %u of %u (dropped %u)\n", (unsigned)n,
+                (unsigned)eventTraceCount, (unsigned)droppedEvents);
+  for (uint32_t i = eventTraceCount - n; i < eventTraceCount; i++) {
+    const TraceEntry &t = eventTrace[i % EVENT_TRACE_LEN];
+    Serial.printf("EVENTS: t=%10u us %-7s %-7s idx=%d latency=%u us\n",
+                  (unsigned)t.event.postedUs, sources[t.event.source],
+                  types[t.event.type], t.event.index,
+                  (unsigned)(t.consumedUs - t.event.postedUs));
   }
-  return false;
 }
 
 std::vector<CityWeatherCache> DataManager::cityCaches;
 std::vector<BusStopCache> DataManager::busCaches;
+std::vector<StockItem> DataManager::stockCache;
+bool DataManager::cacheDirty = false;
+uint32_t DataManager::lastCacheSave = 0;
+
+TaskHandle_t DataManager::netTaskHandle = NULL;
+FetchScheduler DataManager::scheduler;
+std::vector<int> DataManager::weatherJobs;
+std::vector<int> DataManager::busJobs;
+int DataManager::stockJob = -1;
+volatile int DataManager::queueDepth = 0;
+volatile uint32_t DataManager::nextWakeMs = 0;
+volatile int DataManager::jobCount = 0;
+volatile uint32_t DataManager::completedJobs = 0;
 
 void DataManager::begin() {
-  dataMutex = xSemaphoreCreateMutex();
-
   // Start Background Task
   // Stack size 10240 (same as before)
-  xTaskCreatePinnedToCore(networkTask, "NetTask", 10240, NULL, 1, NULL, 0);
+  xTaskCreatePinnedToCore(networkTask, "NetTask", 10240, NULL, 1,
+                          &netTaskHandle, 0);
 }
 
-bool DataManager::getWeatherData(WeatherData &out) {
-  bool updated = false;
-  if (xSemaphoreTake(dataMutex, 5) == pdTRUE) { // Short wait
-    if (weatherDataUpdated) {
-      out = weatherData;
-      weatherDataUpdated = false; // Clear flag
-      updated = true;
-    }
-    xSemaphoreGive(dataMutex);
-  }
-  return updated;
+const WeatherData &DataManager::getWeatherData() { return weatherSnap.read(); }
+
+const BusData &DataManager::getBusData() { return busSnap.read(); }
+
+const BusData &DataManager::getBusStopData(int stop) {
+  return stopSnaps[stop].read();
 }
 
-bool DataManager::getBusData(BusData &out) {
-  bool updated = false;
-  if (xSemaphoreTake(dataMutex, 5) == pdTRUE) {
-    if (busDataUpdated) {
-      out = busData;
-      busDataUpdated = false;
-      updated = true;
-    }
-    xSemaphoreGive(dataMutex);
-  }
-  return updated;
+const std::vector<StockItem> &DataManager::getStockData() {
+  return stockSnap.read();
 }
 
-bool DataManager::getStockData(std::vector<StockItem> &out) {
-  bool updated = false;
-  if (xSemaphoreTake(dataMutex, 5) == pdTRUE) {
-    if (stockDataUpdated) {
-      out = stockData;
-      stockDataUpdated = false;
-      updated = true;
-    }
-    xSemaphoreGive(dataMutex);
+void DataManager::printSyncStats() {
+  weatherSnap.writerHold.print("weather hold");
+  weatherSnap.readerWait.print("weather wait");
+  busSnap.writerHold.print("bus hold");
+  busSnap.readerWait.print("bus wait");
+  for (size_t i = 0; i < busCaches.size() && i < BUS_MAX_STOPS; i++) {
+    if (stopSnaps[i].generation() == 0)
+      continue; // Never published (single stop: no board)
+    char label[24];
+    snprintf(label, sizeof(label), "stop %u hold", (unsigned)i);
+    stopSnaps[i].writerHold.print(label);
+    snprintf(label, sizeof(label), "stop %u wait", (unsigned)i);
+    stopSnaps[i].readerWait.print(label);
   }
-  return updated;
+  stockSnap.writerHold.print("stock hold");
+  stockSnap.readerWait.print("stock wait");
 }
 
-// Getters without clearing flag
-WeatherData DataManager::getCurrentWeatherData() {
-  WeatherData temp;
-  if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-    temp = weatherData;
-    xSemaphoreGive(dataMutex);
-  }
-  return temp;
+void DataManager::printNetStats() {
+  HttpPool::printStats();
+  NetStats::print();
+  printSyncStats();
 }
 
-BusData DataManager::getCurrentBusData() {
-  BusData temp;
-  if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-    temp = busData;
-    xSemaphoreGive(dataMutex);
-  }
-  return temp;
+void DataManager::triggerBusUpdate() {
+  manualBusTrigger = true;
+  notifyUiChange();
+}
+void DataManager::triggerWeatherUpdate() {
+  manualWeatherTrigger = true;
+  notifyUiChange();
+}
+void DataManager::triggerStockUpdate() {
+  manualStockTrigger = true;
+  notifyUiChange();
 }
 
-std::vector<StockItem> DataManager::getCurrentStockData() {
-  std::vector<StockItem> temp;
-  if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-    temp = stockData;
-    xSemaphoreGive(dataMutex);
-  }
-  return temp;
+void DataManager::refreshAll() {
+  manualRefreshAll = true;
+  notifyUiChange();
+}
+
+void DataManager::notifyUiChange() {
+  if (netTaskHandle)
+    xTaskNotifyGive(netTaskHandle);
 }
 
-void DataManager::triggerBusUpdate() { manualBusTrigger = true; }
-void DataManager::triggerWeatherUpdate() { manualWeatherTrigger = true; }
-void DataManager::triggerStockUpdate() { manualStockTrigger = true; }
+int DataManager::getQueueDepth() { return queueDepth; }
+uint32_t DataManager::getNextWakeMs() { return nextWakeMs; }
+int DataManager::getJobCount() { return jobCount; }
+uint32_t DataManager::getCompletedJobs() { return completedJobs; }
 
 // --- BACKGROUND TASK (The "Brain") ---
 void DataManager::networkTask(void *parameter) {
-  // Wait for mutex
-  while (dataMutex == NULL)
-    vTaskDelay(10);
-
-  // 1. Initial Connection / Loading
-  // We can't call GuiController directly safely from here without mutex if Gui
-  // uses it? Actually GuiController has its own internal state, but we should
-  // be careful. Ideally we post messages. But for now, we follow the pattern:
-  // "GuiController::showLoadingScreen" is static and writes to a queue var.
-
-  if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-    GuiController::showLoadingScreen("Connecting WiFi...");
-    xSemaphoreGive(dataMutex);
-  }
-
-  NetworkManager::begin();
-
-  if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-    GuiController::showLoadingScreen("Fetching Weather...");
-    xSemaphoreGive(dataMutex);
-  }
-
-  // --- INITIAL DATA SETUP ---
+  // --- INITIAL DATA SETUP (before WiFi) ---
+  // Settings come from NVS, so the caches and the last-known screens can be
+  // set up while autoConnect is still blocking below.
+  NetworkManager::loadConfig();
+
+#ifdef REPLAY_BASE_URL
+  // Bench builds: every service talks to tools/replay_server.py
+  WeatherService::setBaseUrl(REPLAY_BASE_URL);
+  BusService::setBaseUrl(REPLAY_BASE_URL);
+  StockService::setBaseUrl(REPLAY_BASE_URL);
+#endif
 
   // 1. Cities
   std::vector<String> cities = NetworkManager::getCities();
@@ -171,43 +183,10 @@ void DataManager::networkTask(void *parameter) {
     cityCaches[i].hasData = false;
   }
 
-  // 2. Initial Weather Fetch (City 0)
-  if (!cities.empty()) {
-    Serial.printf("NETWORK: Fetching Primary City: %s\n", cities[0].c_str());
-    WeatherData tempWeather;
-    float pLat, pLon;
-    String pResolved;
-    bool primarySuccess = false;
-
-    if (WeatherService::lookupCoordinates(cities[0], pLat, pLon, pResolved,
-                                          NetworkManager::getOwmApiKey())) {
-      String owmKey = NetworkManager::getOwmApiKey();
-      if (WeatherService::updateWeather(tempWeather, pLat, pLon, owmKey)) {
-        tempWeather.cityName = (pResolved.length() > 0) ? pResolved : cities[0];
-        tempWeather.lastUpdate = millis(); // Set Timestamp
-
-        cityCaches[0].data = tempWeather;
-        cityCaches[0].hasData = true;
-        cityCaches[0].lastUpdate = tempWeather.lastUpdate;
-
-        // Push to Global
-        if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-          weatherData = tempWeather;
-          weatherDataUpdated = true;          // Flag for main loop
-          LedController::update(weatherData); // LED logic
-          xSemaphoreGive(dataMutex);
-        }
-        primarySuccess = true;
-      }
-    }
-    if (!primarySuccess)
-      Serial.println("NETWORK: Failed initial primary fetch.");
-  } else {
-    Serial.println("NETWORK: No cities configured.");
-  }
-
-  // 3. Bus Setup
+  // 2. Bus Stops
   std::vector<String> stopIds = NetworkManager::getBusStops();
+  if (stopIds.size() > BUS_MAX_STOPS)
+    stopIds.resize(BUS_MAX_STOPS);
   GuiController::setBusStopCount(stopIds.size());
 
   busCaches.resize(stopIds.size());
@@ -216,265 +195,303 @@ void DataManager::networkTask(void *parameter) {
     busCaches[i].lastUpdate = 0;
   }
 
-  // 4. Initial Bus Fetch (Stop 0)
-  if (stopIds.size() > 0) {
-    String stopId = stopIds[0];
-    Serial.printf("NETWORK: Fetching Primary Bus Stop: %s\n", stopId.c_str());
-    BusData tempBus;
-    if (BusService::updateBusTimes(tempBus, stopId,
-                                   NetworkManager::getAppId().c_str(),
-                                   NetworkManager::getAppKey().c_str())) {
-      tempBus.lastUpdate = millis();
-      busCaches[0].data = tempBus;
-      busCaches[0].lastUpdate = tempBus.lastUpdate;
-
-      if (xSemaphoreTake(dataMutex, portMAX_DELAY) == pdTRUE) {
-        busData = tempBus;
-        busDataUpdated = true;
-        xSemaphoreGive(dataMutex);
+  // 3. Last-known data from flash: render it right away (flagged stale,
+  // lastUpdate = 0) instead of a loading screen
+  bool cachedScreen = false;
+  if (CacheStore::load(cityCaches, busCaches, stockCache)) {
+    int city = GuiController::getCityIndex();
+    if (city >= 0 && city < (int)cityCaches.size() &&
+        cityCaches[city].hasData) {
+      weatherSnap.publish(cityCaches[city].data);
+      postEvent(EVT_DATA_READY, SRC_WEATHER, city);
+      cachedScreen = true;
+    }
+    int bus = GuiController::getBusIndex();
+    for (size_t i = 0; i < busCaches.size(); i++) {
+      if (busCaches[i].data.stopCode.isEmpty())
+        continue;
+      if (busCaches.size() > 1)
+        stopSnaps[i].publish(busCaches[i].data);
+      if ((int)i == bus) {
+        busSnap.publish(busCaches[i].data);
+        postEvent(EVT_DATA_READY, SRC_BUS, i);
+      } else {
+        postEvent(EVT_CACHE_UPDATED, SRC_BUS, i);
       }
-    } else {
-      Serial.println("NETWORK: Failed initial bus fetch.");
+    }
+    if (!stockCache.empty()) {
+      stockSnap.publish(stockCache);
+      postEvent(EVT_DATA_READY, SRC_STOCK, 0);
     }
   }
 
-  // Tell GUI we are ready to show main screen?
-  // In old code, main.cpp set `pendingWeatherRedraw = true` after setup.
-  // We can simulate this by setting `weatherDataUpdated = true` (already done
-  // above). The main loop will notice this and draw.
+  // 4. Connection
+  // "GuiController::showLoadingScreen" posts a command to the GUI task.
+  if (!cachedScreen)
+    GuiController::showLoadingScreen("Connecting WiFi...");
+
+  NetworkManager::begin();
+
+  if (!cachedScreen)
+    GuiController::showLoadingScreen("Fetching Weather...");
 
-  uint32_t lastStockUpdate = 0;
-  uint32_t lastNetworkRequestMs = 0; // Rate Limiter
+  // 5. Fetch Jobs (TTL background / TTL while on screen)
+  // Never-run jobs are due at once; the active city goes first and the
+  // per-host rate limit interleaves the first bus and stock fetches.
+  int hostOwm = scheduler.addHost("api.openweathermap.org", 1000);
+  int hostTmb = scheduler.addHost("api.tmb.cat", 1000);
+  int hostYahoo = scheduler.addHost("query1.finance.yahoo.com", 1000);
+
+  for (size_t i = 0; i < cityCaches.size(); i++)
+    weatherJobs.push_back(scheduler.addJob("weather", hostOwm, 900000, 600000));
+  for (size_t i = 0; i < busCaches.size(); i++)
+    busJobs.push_back(
+        scheduler.addJob("bus", hostTmb, BUS_TTL_MS, BUS_ACTIVE_TTL_MS));
+  stockJob = scheduler.addJob("stock", hostYahoo, 300000, 300000);
+  jobCount = weatherJobs.size() + busJobs.size() + 1;
 
   // --- MAIN LOOP ---
   for (;;) {
     uint32_t now = millis();
 
-    // Rate Limiting Check (Min 1s between requests)
-    bool safeToRequest = (now - lastNetworkRequestMs > 1000);
-
-    // ---------------- WEATHER ----------------
-    // ---------------- WEATHER ----------------
+    // ---------------- UI STATE ----------------
     int targetCityIndex = GuiController::getCityIndex();
     bool citySwitched = GuiController::hasCityChanged();
     if (citySwitched)
       GuiController::clearCityChanged();
 
-    // Prioritize Manual Trigger or Switched City (Immediate Update if Stale)
-    int cityToUpdate = -1;
+    int targetBusIndex = GuiController::getBusIndex();
+    bool busBoard = GuiController::isBusBoard(); // Every stop is on screen
+    bool stationChanged = GuiController::hasBusStationChanged();
+    if (stationChanged)
+      GuiController::clearBusStationChanged();
 
-    // Only process manual trigger if safe to request
-    if ((manualWeatherTrigger || (citySwitched && targetCityIndex >= 0)) &&
-        safeToRequest) {
-      // If switched, only update if stale (> 10 mins) or no data
-      if (manualWeatherTrigger || !cityCaches[targetCityIndex].hasData ||
-          (now - cityCaches[targetCityIndex].lastUpdate > 600000)) {
-        cityToUpdate = targetCityIndex;
-      }
+    // Active screen gets the short TTL and wins ties
+    GuiController::AppMode app = GuiController::currentApp;
+    for (size_t i = 0; i < weatherJobs.size(); i++)
+      scheduler.setActive(weatherJobs[i], app == GuiController::APP_WEATHER &&
+                                              (int)i == targetCityIndex);
+    for (size_t i = 0; i < busJobs.size(); i++)
+      scheduler.setActive(busJobs[i],
+                          app == GuiController::APP_BUS &&
+                              (busBoard || (int)i == targetBusIndex));
+    scheduler.setActive(stockJob, app == GuiController::APP_STOCK);
+
+    // Manual triggers (always refetch)
+    if (manualWeatherTrigger) {
       manualWeatherTrigger = false;
+      if (targetCityIndex >= 0 && targetCityIndex < (int)weatherJobs.size())
+        scheduler.trigger(weatherJobs[targetCityIndex]);
     }
-
-    // If no priority update, check for Background Updates (All Cities)
-    if (cityToUpdate == -1) {
-      for (size_t i = 0; i < cityCaches.size(); i++) {
-        // Update if never updated (startup) OR stale > 15 mins (900s)
-        if (cityCaches[i].lastUpdate == 0 ||
-            (now - cityCaches[i].lastUpdate > 900000)) {
-          cityToUpdate = i;
-          break; // Update one per loop to yield to Bus/Stocks
-        }
+    if (manualBusTrigger) {
+      manualBusTrigger = false;
+      for (size_t i = 0; i < busJobs.size(); i++) {
+        if (busBoard || (int)i == targetBusIndex)
+          scheduler.trigger(busJobs[i]);
       }
     }
+    if (manualStockTrigger) {
+      manualStockTrigger = false;
+      scheduler.trigger(stockJob);
+    }
+    if (manualRefreshAll) {
+      manualRefreshAll = false;
+      for (int j : weatherJobs)
+        scheduler.trigger(j);
+      for (int j : busJobs)
+        scheduler.trigger(j);
+      scheduler.trigger(stockJob);
+    }
 
-    // Execute Update
-    if (cityToUpdate >= 0 && cityToUpdate < (int)cityCaches.size()) {
-      if (safeToRequest) {
-        Serial.printf("NETWORK: Updating City %d: %s\n", cityToUpdate,
-                      cityCaches[cityToUpdate].cityName.c_str());
-        lastNetworkRequestMs = now; // Update timestamp
-
-        WeatherData temp;
-        float lat, lon;
-        String res;
-        String owmKey = NetworkManager::getOwmApiKey();
-
-        if (WeatherService::lookupCoordinates(cityCaches[cityToUpdate].cityName,
-                                              lat, lon, res, owmKey)) {
-          currentUpdatingCityIndex = cityToUpdate; // Start Update
-          weatherStatusChanged = true;             // Signal UI
-          vTaskDelay(50);                          // Ensure UI paints Yellow
-
-          bool success = WeatherService::updateWeather(temp, lat, lon, owmKey);
-          if (success)
-            Serial.println("NETWORK: Weather Update Success");
-          else
-            Serial.println("NETWORK: Weather Update Failed");
-
-          currentUpdatingCityIndex = -1; // End Update
-
-          if (success) {
-            temp.cityName =
-                (res.length() > 0) ? res : cityCaches[cityToUpdate].cityName;
-            temp.lastUpdate = now; // Set Timestamp
-
-            cityCaches[cityToUpdate].data = temp;
-            cityCaches[cityToUpdate].lastUpdate = now;
-            cityCaches[cityToUpdate].hasData = true;
-
-            // If we updated the currently active city, push to global
-            // immediately
-            if (cityToUpdate == targetCityIndex) {
-              xSemaphoreTake(dataMutex, portMAX_DELAY);
-              weatherData = temp;
-              weatherDataUpdated = true;
-              xSemaphoreGive(dataMutex);
-            }
-
-            if (cityToUpdate == 0) {
-              LedController::update(temp);
-            }
-          }
-          // Always trigger update to clear "Updating" status in UI
-          if (cityToUpdate == targetCityIndex) {
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            if (!success) {
-              // If failed, we still want to notify UI to redraw (to clear
-              // Yellow dot) We don't update weatherData, just the flag.
-            }
-            weatherDataUpdated = true;
-            xSemaphoreGive(dataMutex);
-          }
-        }
-      } // End if (safeToRequest)
-    } // End if (cityToUpdate >= 0)
-
-    // If we just switched to a cached city (and didn't need update), load
-    // from cache
-    if (citySwitched && cityToUpdate != targetCityIndex &&
-        targetCityIndex >= 0 && cityCaches[targetCityIndex].hasData) {
-      xSemaphoreTake(dataMutex, portMAX_DELAY);
-      weatherData = cityCaches[targetCityIndex].data;
-      weatherDataUpdated = true;
+    // If we just switched to a cached city/stop, show the cache right away.
+    // The active TTL decides whether a refresh follows.
+    if (citySwitched && targetCityIndex >= 0 &&
+        targetCityIndex < (int)cityCaches.size() &&
+        cityCaches[targetCityIndex].hasData) {
+      weatherSnap.publish(cityCaches[targetCityIndex].data);
+      postEvent(EVT_DATA_READY, SRC_WEATHER, targetCityIndex);
       // Let's ensure LED is updated on switch too, BUT ONLY IF switching
       // to Primary City
       if (targetCityIndex == 0) {
-        LedController::update(weatherData);
+        LedController::update(cityCaches[targetCityIndex].data);
       }
-      xSemaphoreGive(dataMutex);
+    }
+    if (stationChanged && targetBusIndex >= 0 &&
+        targetBusIndex < (int)busCaches.size() &&
+        !busCaches[targetBusIndex].data.stopCode.isEmpty()) {
+      busSnap.publish(busCaches[targetBusIndex].data);
+      postEvent(EVT_DATA_READY, SRC_BUS, targetBusIndex);
     }
 
-    // ---------------- BUS ----------------
-    int targetBusIndex = GuiController::getBusIndex();
-    bool stationChanged = GuiController::hasBusStationChanged();
-    if (stationChanged)
-      GuiController::clearBusStationChanged();
-
-    int busToUpdate = -1;
-
-    // Prioritize Manual Trigger or Change
-    if ((manualBusTrigger || (stationChanged && targetBusIndex >= 0)) &&
-        safeToRequest) {
-      if (manualBusTrigger ||
-          busCaches[targetBusIndex].data.stopCode.isEmpty() ||
-          (now - busCaches[targetBusIndex].lastUpdate > 60000)) {
-        busToUpdate = targetBusIndex;
-      } else {
-        // Cache Hit
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
-        busData = busCaches[targetBusIndex].data;
-        busDataUpdated = true;
-        xSemaphoreGive(dataMutex);
+    // ---------------- FETCH (one job per pass) ----------------
+    int job = scheduler.next(now);
+    if (job >= 0) {
+      scheduler.begin(job, now);
+      bool success = false;
+      for (size_t i = 0; i < weatherJobs.size(); i++) {
+        if (weatherJobs[i] == job)
+          success = runWeatherJob(i, targetCityIndex, now);
       }
-      manualBusTrigger = false;
+      for (size_t i = 0; i < busJobs.size(); i++) {
+        if (busJobs[i] == job)
+          success = runBusJob(i, targetBusIndex, now);
+      }
+      if (job == stockJob)
+        success = runStockJob(now);
+      scheduler.complete(job, now, success);
+      completedJobs++;
     }
 
-    // Background Updates (All Stops)
-    if (busToUpdate == -1) {
-      for (size_t i = 0; i < busCaches.size(); i++) {
-        // Update if never updated (startup) OR stale > 60s
-        if (busCaches[i].lastUpdate == 0 ||
-            (now - busCaches[i].lastUpdate > 60000)) {
-          busToUpdate = i;
-          break;
-        }
-      }
+    now = millis();
+    queueDepth = scheduler.queueDepth(now);
+    nextWakeMs = scheduler.msUntilNext(now);
+#if NET_TRACE
+    if (job >= 0)
+      Serial.printf("NETWORK: Queue depth %d, next due in %u ms\n",
+                    (int)queueDepth, (unsigned)nextWakeMs);
+#endif
+
+    HttpPool::closeIdle(); // Release TLS buffers between refresh bursts
+
+    // Persist caches after successful updates, at most every
+    // CACHE_SAVE_MIN_MS to limit flash wear (bus data changes every minute)
+    if (cacheDirty &&
+        (lastCacheSave == 0 || now - lastCacheSave >= CACHE_SAVE_MIN_MS)) {
+      CacheStore::save(cityCaches, busCaches, stockCache);
+      lastCacheSave = now ? now : 1;
+      cacheDirty = false;
     }
 
-    // Execute Update
-    if (busToUpdate >= 0 && busToUpdate < (int)busCaches.size()) {
-      if (safeToRequest) {
-        String stopId = busCaches[busToUpdate].id;
-        Serial.printf("NETWORK: Updating Bus Stop %s...\n", stopId.c_str());
-        lastNetworkRequestMs = now;
-
-        BusData tempBus;
-        currentUpdatingBusIndex = busToUpdate; // Start Update
-        busStatusChanged = true;               // Signal UI
-        vTaskDelay(50);                        // Ensure UI paints Yellow
-
-        bool success = BusService::updateBusTimes(
-            tempBus, stopId, NetworkManager::getAppId().c_str(),
-            NetworkManager::getAppKey().c_str());
-
-        if (success)
-          Serial.println("NETWORK: Bus Update Success");
-        else
-          Serial.println("NETWORK: Bus Update Failed");
-
-        currentUpdatingBusIndex = -1; // End Update
-
-        if (success) {
-          tempBus.lastUpdate = now;
-          busCaches[busToUpdate].data = tempBus;
-          busCaches[busToUpdate].lastUpdate = now;
-
-          // Update global busData if this is the active bus
-          if (busToUpdate == targetBusIndex) {
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            busData = tempBus;
-            xSemaphoreGive(dataMutex);
-          }
-        }
-      }
+    NetworkManager::handleClient();
 
-      // Always trigger update to clear "Updating" status
-      if (busToUpdate == targetBusIndex) {
-        xSemaphoreTake(dataMutex, portMAX_DELAY);
-        busDataUpdated = true;
-        xSemaphoreGive(dataMutex);
-      }
+    // Sleep until the earliest deadline or a UI trigger (task notify).
+    // Capped so the settings web server keeps being serviced.
+    if (job < 0) {
+      uint32_t wait = nextWakeMs;
+      if (wait > WEB_POLL_MS)
+        wait = WEB_POLL_MS;
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
     }
+  }
+}
 
-    // ---------------- STOCK ----------------
-    if ((now - lastStockUpdate > 300000 || manualStockTrigger) &&
-        safeToRequest) {
-      manualStockTrigger = false;
-      String syms = NetworkManager::getStockSymbols();
-      if (syms.length() > 0) {
-        Serial.println("NETWORK: Updating Stocks...");
-        lastNetworkRequestMs = now;
-
-        isUpdatingStock = true;
-        std::vector<StockItem> items = StockService::getQuotes(syms);
-        isUpdatingStock = false;
-
-        if (!items.empty()) {
-          xSemaphoreTake(dataMutex, portMAX_DELAY);
-          stockData = items;
-          stockLastUpdateTime = now;
-          stockDataUpdated = true;
-          xSemaphoreGive(dataMutex);
-        } else {
-          // Failed or empty - still update flag to clear status
-          xSemaphoreTake(dataMutex, portMAX_DELAY);
-          stockDataUpdated = true;
-          xSemaphoreGive(dataMutex);
-        }
-      }
-      lastStockUpdate = now;
+bool DataManager::runWeatherJob(int cityToUpdate, int targetCityIndex,
+                                uint32_t now) {
+  Serial.printf("NETWORK: Updating City %d: %s\n", cityToUpdate,
+                cityCaches[cityToUpdate].cityName.c_str());
+
+  WeatherData temp = {}; // Zeroed: empty forecast slots read as date/time 0
+  float lat, lon;
+  String res;
+  String owmKey = NetworkManager::getOwmApiKey();
+
+  if (!WeatherService::lookupCoordinates(cityCaches[cityToUpdate].cityName, lat,
+                                         lon, res, owmKey))
+    return false;
+
+  currentUpdatingCityIndex = cityToUpdate; // Start Update
+  postEvent(EVT_FETCH_STARTED, SRC_WEATHER, cityToUpdate);
+
+  bool success = WeatherService::updateWeather(temp, lat, lon, owmKey);
+  if (success)
+    Serial.println("NETWORK: Weather Update Success");
+  else
+    Serial.println("NETWORK: Weather Update Failed");
+
+  currentUpdatingCityIndex = -1; // End Update
+
+  if (success) {
+    const String &name =
+        (res.length() > 0) ? res : cityCaches[cityToUpdate].cityName;
+    Translit::forDisplay(name.c_str(), temp.cityName,
+                         sizeof(temp.cityName));
+    temp.lastUpdate = now; // Set Timestamp
+
+    cityCaches[cityToUpdate].data = temp;
+    cityCaches[cityToUpdate].lastUpdate = now;
+    cityCaches[cityToUpdate].hasData = true;
+    cacheDirty = true;
+
+    // If we updated the currently active city, push to global immediately.
+    // READY only with a snapshot: the GUI matches it against its index.
+    if (cityToUpdate == targetCityIndex) {
+      weatherSnap.publish(temp);
+      postEvent(EVT_DATA_READY, SRC_WEATHER, cityToUpdate);
+    } else {
+      postEvent(EVT_CACHE_UPDATED, SRC_WEATHER, cityToUpdate);
     }
 
-    NetworkManager::handleClient();
-    vTaskDelay(pdMS_TO_TICKS(10));
+    if (cityToUpdate == 0) {
+      LedController::update(temp);
+    }
+  } else {
+    postEvent(EVT_FETCH_FAILED, SRC_WEATHER, cityToUpdate);
+  }
+  return success;
+}
+
+bool DataManager::runBusJob(int busToUpdate, int targetBusIndex,
+                            uint32_t now) {
+  String stopId = busCaches[busToUpdate].id;
+  Serial.printf("NETWORK: Updating Bus Stop %s...\n", stopId.c_str());
+
+  BusData tempBus;
+  currentUpdatingBusIndex = busToUpdate; // Start Update
+  postEvent(EVT_FETCH_STARTED, SRC_BUS, busToUpdate);
+
+  bool success = BusService::updateBusTimes(
+      tempBus, stopId, NetworkManager::getAppId().c_str(),
+      NetworkManager::getAppKey().c_str());
+
+  if (success)
+    Serial.println("NETWORK: Bus Update Success");
+  else
+    Serial.println("NETWORK: Bus Update Failed");
+
+  currentUpdatingBusIndex = -1; // End Update
+
+  if (success) {
+    tempBus.lastUpdate = millis(); // Response time: the ETA countdown base
+    busCaches[busToUpdate].data = tempBus;
+    busCaches[busToUpdate].lastUpdate = now;
+    cacheDirty = true;
+
+    // Every stop feeds the board (2+ stops); busData follows the active one
+    if (busCaches.size() > 1)
+      stopSnaps[busToUpdate].publish(tempBus);
+    if (busToUpdate == targetBusIndex) {
+      busSnap.publish(std::move(tempBus));
+      postEvent(EVT_DATA_READY, SRC_BUS, busToUpdate);
+    } else {
+      postEvent(EVT_CACHE_UPDATED, SRC_BUS, busToUpdate);
+    }
+  } else {
+    postEvent(EVT_FETCH_FAILED, SRC_BUS, busToUpdate);
+  }
+  return success;
+}
+
+bool DataManager::runStockJob(uint32_t now) {
+  String syms = NetworkManager::getStockSymbols();
+  if (syms.length() == 0)
+    return true; // Nothing configured, check again after the TTL
+
+  Serial.println("NETWORK: Updating Stocks...");
+
+  isUpdatingStock = true;
+  postEvent(EVT_FETCH_STARTED, SRC_STOCK, 0);
+  std::vector<StockItem> items = StockService::getQuotes(syms);
+  isUpdatingStock = false;
+
+  bool success = !items.empty();
+  if (success) {
+    stockLastUpdateTime = now;
+    stockCache = items;
+    cacheDirty = true;
+    stockSnap.publish(std::move(items));
+    postEvent(EVT_DATA_READY, SRC_STOCK, 0);
+  } else {
+    postEvent(EVT_FETCH_FAILED, SRC_STOCK, 0); // Clears the updating status
   }
+  return success;
 }
@@ -3,10 +3,13 @@
 
 #include <Arduino.h>
 #include <freertos/FreeRTOS.h>
-#include <freertos/semphr.h>
+#include <freertos/task.h>
 #include <vector>
 
 #include "BusService.h"
+#include "EventQueue.h"
+#include "FetchScheduler.h"
+#include "Snapshot.h"
 #include "StockService.h"
 #include "WeatherService.h"
 
@@ -24,52 +27,93 @@ struct BusStopCache {
   uint32_t lastUpdate;
 };
 
+// Network task -> GUI notifications, consumed once per UI frame
+enum DataSource : uint8_t { SRC_WEATHER, SRC_BUS, SRC_STOCK };
+enum DataEventType : uint8_t {
+  EVT_FETCH_STARTED,
+  EVT_DATA_READY, // New snapshot published for this source/index
+  EVT_FETCH_FAILED,
+  EVT_CACHE_UPDATED // Fetched into a background cache, no new snapshot
+};
+
+struct DataEvent {
+  DataEventType type;
+  DataSource source;
+  int8_t index;      // City / bus stop index (0 for stocks)
+  uint32_t postedUs; // micros() when queued
+};
+
 class DataManager {
 public:
   static void begin(); // Starts background task
 
-  // Thread-Safe Data Access (Returns true if new data available since last
-  // check)
-  static bool getWeatherData(WeatherData &out);
-  static bool getBusData(BusData &out);
-  static bool getStockData(std::vector<StockItem> &out);
-
-  // Getters for specific fields without consuming the "Updated" flag
-  // (Used for initial display or non-event driven reads)
-  static WeatherData getCurrentWeatherData();
-  static BusData getCurrentBusData();
-  static std::vector<StockItem> getCurrentStockData();
+  // Latest published data. Wait-free, GUI loop only: the reference stays
+  // valid until the next call for the same type.
+  static const WeatherData &getWeatherData();
+  static const BusData &getBusData();
+  // Any stop's latest data, published on every fetch (departures board)
+  static const BusData &getBusStopData(int stop);
+  static const std::vector<StockItem> &getStockData();
 
   // Trigger updates manually (e.g. from UI)
   static void triggerBusUpdate();
   static void triggerWeatherUpdate();
   static void triggerStockUpdate();
+  static void notifyUiChange(); // Wake the network task (city/stop switch)
+  static void refreshAll();     // Refetch every city, stop and the stocks
+
+  // TMB poll interval (visible / background). The bus view counts ETAs
+  // down locally between polls, so these can be longer than a minute.
+  static const uint32_t BUS_ACTIVE_TTL_MS = 120000;
+  static const uint32_t BUS_TTL_MS = 300000;
 
-  // Status
   // Status
   static bool isWeatherUpdating(int cityIndex);
   static bool isBusUpdating(int busIndex);
   static bool isStockUpdating();
   static uint32_t getStockLastUpdate();
 
-  // Status Change Signals (True when "Is Updating" state changes)
-  static bool getWeatherStatusChanged();
-  static bool getBusStatusChanged();
+  // Events (GUI loop only): returns false when the queue is empty
+  static bool pollEvent(DataEvent &out);
+  static void dumpEventTrace(); // Last events with queue latency
 
-private:
-  static void networkTask(void *parameter); // The background loop
+  // Scheduler introspection (updated by the network task every pass)
+  static int getQueueDepth();     // Jobs due right now
+  static uint32_t getNextWakeMs(); // Time until the earliest deadline
+  static int getJobCount();        // 0 until the jobs are set up
+  static uint32_t getCompletedJobs(); // Fetch jobs run since boot
 
-  static SemaphoreHandle_t dataMutex;
+  // Publish/read latency histograms of the snapshots
+  static void printSyncStats();
+  // Connection pool, per-endpoint and snapshot stats (serial 'n')
+  static void printNetStats();
 
-  // State
-  static WeatherData weatherData;
-  static BusData busData;
-  static std::vector<StockItem> stockData;
+private:
+  static void networkTask(void *parameter); // The background loop
+  static bool runWeatherJob(int cityToUpdate, int targetCityIndex,
+                            uint32_t now);
+  static bool runBusJob(int busToUpdate, int targetBusIndex, uint32_t now);
+  static bool runStockJob(uint32_t now);
+  static void postEvent(DataEventType type, DataSource source, int index);
+
+  static const uint32_t WEB_POLL_MS = 100; // Max sleep (web server polling)
+
+  static TaskHandle_t netTaskHandle;
+  static FetchScheduler scheduler;
+  static std::vector<int> weatherJobs; // Job id per city cache
+  static std::vector<int> busJobs;     // Job id per bus stop cache
+  static int stockJob;
+  static volatile int queueDepth;
+  static volatile uint32_t nextWakeMs;
+  static volatile int jobCount;
+  static volatile uint32_t completedJobs;
+
+  // State (written by the network task, read by the GUI loop)
+  static Snapshot<WeatherData> weatherSnap;
+  static Snapshot<BusData> busSnap;
+  static Snapshot<BusData> stopSnaps[BUS_MAX_STOPS];
+  static Snapshot<std::vector<StockItem>> stockSnap;
 
-  // Update Flags (Volatile for ISR/Thread safety)
-  static volatile bool weatherDataUpdated;
-  static volatile bool busDataUpdated;
-  static volatile bool stockDataUpdated;
   // static volatile bool isUpdatingWeather; // Replaced by index check
   // static volatile bool isUpdatingBus;     // Replaced by index check
   static volatile int currentUpdatingCityIndex;
@@ -77,16 +121,29 @@ private:
   static volatile bool isUpdatingStock;
   static volatile uint32_t stockLastUpdateTime;
 
-  static volatile bool weatherStatusChanged;
-  static volatile bool busStatusChanged;
+  // Event queue + trace of consumed events (trace written by the consumer)
+  static const int EVENT_TRACE_LEN = 64;
+  struct TraceEntry {
+    DataEvent event;
+    uint32_t consumedUs;
+  };
+  static SpscQueue<DataEvent, 32> events;
+  static volatile uint32_t droppedEvents;
+  static TraceEntry eventTrace[EVENT_TRACE_LEN];
+  static uint32_t eventTraceCount;
 
   static volatile bool manualBusTrigger;
   static volatile bool manualWeatherTrigger;
   static volatile bool manualStockTrigger;
+  static volatile bool manualRefreshAll;
 
-  // Caches
+  // Caches (persisted to flash by CacheStore)
   static std::vector<CityWeatherCache> cityCaches;
   static std::vector<BusStopCache> busCaches;
+  static std::vector<StockItem> stockCache;
+  static bool cacheDirty;
+  static uint32_t lastCacheSave;
+  static const uint32_t CACHE_SAVE_MIN_MS = 300000;
 };
 
 #endif
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <utility>
+
+// Log2 latency histogram in microseconds: bucket i counts samples in
+// [2^(i-1), 2^i) us, bucket 0 is "< 1 us", the last one is open ended.
+// One writer per histogram; print() from anywhere (counts are advisory).
+class LatencyHistogram {
+public:
+  static const int BUCKETS = 16; // Up to ~16 ms, then overflow
+
+  void record(uint32_t us) {
+    int b = 0;
+    while (us && b < BUCKETS - 1) {
+      us >>= 1;
+      b++;
+    }
+    counts[b]++;
+    samples++;
+  }
+
+  uint32_t count() const { return samples; }
+
+  void print(const char *name) const {
+    Serial.printf("SYNC: %-14s n=%u", name, (unsigned)samples);
+    for (int i = 0; i < BUCKETS; i++) {
+      if (counts[i])
+        Serial.printf(" <%uus:%u", 1u << i, (unsigned)counts[i]);
+    }
+    Serial.println();
+  }
+
+private:
+  volatile uint32_t counts[BUCKETS] = {};
+  volatile uint32_t samples = 0;
+};
+
+// Wait-free single-writer / single-reader publication of T.
+// Triple buffer: the writer fills its back slot and swaps it with the
+// "latest" slot; the reader swaps "latest" with its front slot only when a
+// newer one was published. Neither side ever waits, and the writer never
+// touches the slot the reader holds, so the returned const reference stays
+// valid (even for String/vector members) until the reader's next read().
+// generation() increments on every publish().
+template <typename T> class Snapshot {
+public:
+  // Writer side (network task)
+  void publish(const T &value) {
+    uint32_t t0 = micros();
+    slots[back] = value;
+    flip();
+    writerHold.record(micros() - t0);
+  }
+  void publish(T &&value) {
+    uint32_t t0 = micros();
+    slots[back] = std::move(value);
+    flip();
+    writerHold.record(micros() - t0);
+  }
+  // Reader side (GUI loop only). Generation is sampled before the swap so
+  // it never runs ahead of the data returned.
+  const T &read(uint32_t *generation = nullptr) {
+    uint32_t t0 = micros();
+    uint32_t g = gen.load(std::memory_order_acquire);
+    if (latest.load(std::memory_order_acquire) & FRESH)
+      front = latest.exchange(front, std::memory_order_acq_rel) & INDEX;
+    if (generation)
+      *generation = g;
+    readerWait.record(micros() - t0);
+    return slots[front];
+  }
+
+  uint32_t generation() const { return gen.load(std::memory_order_acquire); }
+
+  LatencyHistogram writerHold; // publish(): copy into back slot + flip
+  LatencyHistogram readerWait; // read(): time the GUI spends getting data
+
+private:
+  static const uint8_t INDEX = 0x03;
+  static const uint8_t FRESH = 0x04; // Set on "latest" by publish()
+
+  void flip() {
+    back = latest.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX;
+    gen.fetch_add(1, std::memory_order_release);
+  }
+
+  T slots[3];
+  uint8_t back = 0;                  // Writer-owned
+  uint8_t front = 1;                 // Reader-owned
+  std::atomic<uint8_t> latest{2};    // Shared, FRESH bit = unread publish
+  std::atomic<uint32_t> gen{0};
+};
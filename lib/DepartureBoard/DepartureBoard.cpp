@@ -0,0 +1,126 @@
+#include "DepartureBoard.h"
+#include <algorithm>
+
+static bool earlier(const BusArrival &a, const BusArrival &b) {
+  return a.seconds < b.seconds;
+}
+
+void DepartureBoard::setStop(int stop, const BusData &data) {
+  if (data.stopName.length() > 0)
+    names[stop] = data.stopName;
+  else
+    names[stop] = "Stop: " + data.stopCode;
+  updated[stop] = data.lastUpdate;
+  loaded[stop] = true;
+}
+
+void DepartureBoard::rebase(uint32_t nowMs) {
+  if (merged.arrivals.empty()) {
+    merged.lastUpdate = nowMs;
+    return;
+  }
+  int shift = (nowMs - merged.lastUpdate) / 1000;
+  if (shift <= 0)
+    return;
+  merged.lastUpdate += shift * 1000;
+  for (BusArrival &a : merged.arrivals)
+    a.seconds -= shift;
+}
+
+int DepartureBoard::offset(const BusData &data, uint32_t nowMs) const {
+  // Flash data has no time base: counted down from the merge instead
+  uint32_t base = data.lastUpdate ? data.lastUpdate : nowMs;
+  return (int32_t)(base - merged.lastUpdate) / 1000;
+}
+
+void DepartureBoard::rebuild(const BusData *const *stops, int n,
+                             uint32_t nowMs) {
+  uint32_t t0 = micros();
+  count = n < BUS_MAX_STOPS ? n : BUS_MAX_STOPS;
+  merged.arrivals.clear();
+  merged.lastUpdate = nowMs;
+
+  size_t pos[BUS_MAX_STOPS] = {};
+  int shift[BUS_MAX_STOPS] = {};
+  size_t total = 0;
+  for (int s = 0; s < count; s++) {
+    loaded[s] = false;
+    if (!stops[s])
+      continue;
+    setStop(s, *stops[s]);
+    shift[s] = offset(*stops[s], nowMs);
+    total += stops[s]->arrivals.size();
+  }
+  merged.arrivals.reserve(total);
+
+  // k-way merge: take the earliest head each step. k <= BUS_MAX_STOPS, so a
+  // linear scan of the heads beats a heap; ties go to the lower stop.
+  for (;;) {
+    int best = -1, bestSec = 0;
+    for (int s = 0; s < count; s++) {
+      if (!loaded[s] || pos[s] >= stops[s]->arrivals.size())
+        continue;
+      int sec = stops[s]->arrivals[pos[s]].seconds + shift[s];
+      if (best < 0 || sec < bestSec) {
+        best = s;
+        bestSec = sec;
+      }
+    }
+    if (best < 0)
+      break;
+    merged.arrivals.push_back(stops[best]->arrivals[pos[best]++]);
+    merged.arrivals.back().stop = best;
+    merged.arrivals.back().seconds = bestSec;
+  }
+
+  Serial.printf("BOARD: %d stops rebuilt, %u arrivals in %u us\n", count,
+                (unsigned)total, (unsigned)(micros() - t0));
+}
+
+void DepartureBoard::updateStop(int stop, const BusData &data,
+                                uint32_t nowMs) {
+  if (stop < 0 || stop >= BUS_MAX_STOPS)
+    return;
+  uint32_t t0 = micros();
+  if (stop >= count)
+    count = stop + 1;
+  rebase(nowMs);
+  setStop(stop, data);
+
+  // The rest stays sorted without this stop's old arrivals...
+  std::vector<BusArrival> &all = merged.arrivals;
+  all.erase(std::remove_if(all.begin(), all.end(),
+                           [stop](const BusArrival &a) {
+                             return a.stop == stop;
+                           }),
+            all.end());
+
+  // ...and its new ones are sorted too: append and merge the two runs
+  size_t mid = all.size();
+  int shift = offset(data, nowMs);
+  for (const BusArrival &a : data.arrivals) {
+    all.push_back(a);
+    all.back().stop = stop;
+    all.back().seconds += shift;
+  }
+  std::inplace_merge(all.begin(), all.begin() + mid, all.end(), earlier);
+
+  Serial.printf("BOARD: Stop %d merged, %u + %u arrivals in %u us\n", stop,
+                (unsigned)mid, (unsigned)data.arrivals.size(),
+                (unsigned)(micros() - t0));
+}
+
+uint32_t DepartureBoard::oldestUpdate() const {
+  uint32_t oldest = 0;
+  bool any = false;
+  for (int s = 0; s < count; s++) {
+    if (!loaded[s])
+      continue;
+    if (updated[s] == 0)
+      return 0;
+    if (!any || (int32_t)(updated[s] - oldest) < 0)
+      oldest = updated[s];
+    any = true;
+  }
+  return oldest;
+}
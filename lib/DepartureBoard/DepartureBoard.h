@@ -0,0 +1,41 @@
+#pragma once
+
+#include "BusService.h"
+#include <Arduino.h>
+#include <vector>
+
+// Arrivals of every configured stop merged into one list by due time.
+// Each stop's arrivals come sorted (BusService), so the board is built with
+// a k-way merge and a stop refresh only takes that stop's arrivals out and
+// merges its new ones back in: linear either way, never a full re-sort.
+//
+// data() reads like a single stop, so BusView renders it unchanged: each
+// arrival carries its stop index (BusArrival::stop) and `seconds` relative
+// to data().lastUpdate, the board's time base. The base moves forward in
+// whole seconds on every merge, which keeps the values exact and small.
+// Pure C++ on Arduino String: GUI task only.
+class DepartureBoard {
+public:
+  // Replaces every stop; stops[i] may be NULL (no data yet)
+  void rebuild(const BusData *const *stops, int count, uint32_t nowMs);
+  // One stop refreshed: replace its arrivals, keep everyone else's
+  void updateStop(int stop, const BusData &data, uint32_t nowMs);
+
+  const BusData &data() const { return merged; }
+  int stopCount() const { return count; }
+  bool hasStop(int stop) const { return stop < count && loaded[stop]; }
+  const String &stopName(int stop) const { return names[stop]; }
+  // Oldest response among the stops with data; 0 if one is from flash
+  uint32_t oldestUpdate() const;
+
+private:
+  BusData merged;
+  String names[BUS_MAX_STOPS];     // Row tags
+  uint32_t updated[BUS_MAX_STOPS]; // Response time per stop, 0 = flash
+  bool loaded[BUS_MAX_STOPS] = {};
+  int count = 0;
+
+  void setStop(int stop, const BusData &data);
+  void rebase(uint32_t nowMs);
+  int offset(const BusData &data, uint32_t nowMs) const;
+};
@@ -0,0 +1,167 @@
+#include "FetchScheduler.h"
+
+FetchScheduler::FetchScheduler() : retryMs(30000), numHosts(0), numJobs(0) {}
+
+int FetchScheduler::addHost(const char *name, uint32_t minIntervalMs) {
+  if (numHosts >= SCHED_MAX_HOSTS)
+    return -1;
+  Host &h = hosts[numHosts];
+  h.name = name;
+  h.minIntervalMs = minIntervalMs;
+  h.lastRequest = 0;
+  h.used = false;
+  return numHosts++;
+}
+
+int FetchScheduler::addJob(const char *name, int host, uint32_t ttlMs,
+                           uint32_t activeTtlMs) {
+  if (numJobs >= SCHED_MAX_JOBS || host < 0 || host >= numHosts)
+    return -1;
+  Job &j = jobs[numJobs];
+  j.name = name;
+  j.host = host;
+  j.ttlMs = ttlMs;
+  j.activeTtlMs = activeTtlMs;
+  j.lastRun = 0;
+  j.lastSuccess = 0;
+  j.hasRun = false;
+  j.succeeded = false;
+  j.active = false;
+  j.forced = false;
+  return numJobs++;
+}
+
+void FetchScheduler::setActive(int job, bool active) {
+  if (job >= 0 && job < numJobs)
+    jobs[job].active = active;
+}
+
+bool FetchScheduler::isActive(int job) const {
+  return job >= 0 && job < numJobs && jobs[job].active;
+}
+
+void FetchScheduler::trigger(int job) {
+  if (job >= 0 && job < numJobs)
+    jobs[job].forced = true;
+}
+
+uint32_t FetchScheduler::dueAt(const Job &j) const {
+  if (!j.hasRun || j.forced)
+    return j.lastRun; // Already in the past
+  if (!j.succeeded) {
+    uint32_t ttl = j.active ? j.activeTtlMs : j.ttlMs;
+    return j.lastRun + (retryMs < ttl ? retryMs : ttl);
+  }
+  return j.lastSuccess + (j.active ? j.activeTtlMs : j.ttlMs);
+}
+
+uint32_t FetchScheduler::hostReadyAt(const Host &h) const {
+  return h.used ? h.lastRequest + h.minIntervalMs : 0;
+}
+
+int FetchScheduler::next(uint32_t now) const {
+  int best = -1;
+  int32_t bestLate = 0;
+  for (int i = 0; i < numJobs; i++) {
+    const Job &j = jobs[i];
+    uint32_t due = dueAt(j);
+    if (!j.forced && j.hasRun && !reached(due, now))
+      continue;
+    const Host &h = hosts[j.host];
+    if (h.used && !reached(hostReadyAt(h), now))
+      continue; // Rate limited, another host may still go
+
+    // Forced and active jobs first, then the most overdue one
+    int32_t late = (int32_t)(now - due);
+    if (best < 0) {
+      best = i;
+      bestLate = late;
+      continue;
+    }
+    const Job &b = jobs[best];
+    int rankJ = (j.forced ? 2 : 0) + (j.active ? 1 : 0);
+    int rankB = (b.forced ? 2 : 0) + (b.active ? 1 : 0);
+    if (rankJ > rankB || (rankJ == rankB && late > bestLate)) {
+      best = i;
+      bestLate = late;
+    }
+  }
+  return best;
+}
+
+void FetchScheduler::begin(int job, uint32_t now) {
+  if (job < 0 || job >= numJobs)
+    return;
+  Job &j = jobs[job];
+  j.forced = false;
+  Host &h = hosts[j.host];
+  h.lastRequest = now;
+  h.used = true;
+}
+
+void FetchScheduler::complete(int job, uint32_t now, bool success) {
+  if (job < 0 || job >= numJobs)
+    return;
+  Job &j = jobs[job];
+  j.hasRun = true;
+  j.lastRun = now;
+  j.succeeded = success;
+  if (success)
+    j.lastSuccess = now;
+}
+
+uint32_t FetchScheduler::nextDue(int job, uint32_t now) const {
+  if (job < 0 || job >= numJobs)
+    return UINT32_MAX;
+  const Job &j = jobs[job];
+  if (j.forced || !j.hasRun)
+    return 0;
+  uint32_t due = dueAt(j);
+  return reached(due, now) ? 0 : due - now;
+}
+
+uint32_t FetchScheduler::msUntilNext(uint32_t now) const {
+  uint32_t best = UINT32_MAX;
+  for (int i = 0; i < numJobs; i++) {
+    uint32_t wait = nextDue(i, now);
+    const Host &h = hosts[jobs[i].host];
+    if (h.used) {
+      uint32_t ready = hostReadyAt(h);
+      uint32_t hostWait = reached(ready, now) ? 0 : ready - now;
+      if (hostWait > wait)
+        wait = hostWait;
+    }
+    if (wait < best)
+      best = wait;
+  }
+  return best;
+}
+
+int FetchScheduler::queueDepth(uint32_t now) const {
+  int depth = 0;
+  for (int i = 0; i < numJobs; i++) {
+    if (nextDue(i, now) == 0)
+      depth++;
+  }
+  return depth;
+}
+
+bool FetchScheduler::hasRun(int job) const {
+  return job >= 0 && job < numJobs && jobs[job].hasRun;
+}
+
+uint32_t FetchScheduler::lastSuccess(int job) const {
+  return (job >= 0 && job < numJobs) ? jobs[job].lastSuccess : 0;
+}
+
+const char *FetchScheduler::jobName(int job) const {
+  return (job >= 0 && job < numJobs) ? jobs[job].name : "";
+}
+
+int FetchScheduler::jobHost(int job) const {
+  return (job >= 0 && job < numJobs) ? jobs[job].host : -1;
+}
+
+const char *FetchScheduler::hostName(int host) const {
+  return (host >= 0 && host < numHosts) ? hosts[host].name : "";
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+
+// Deadline-driven fetch scheduler.
+// Pure C++ (no Arduino deps): time is passed in by the caller, so the same
+// code runs on the device (millis()) and in tools/scheduler_sim.cpp.
+// Not thread-safe: owned by the network task.
+
+#define SCHED_MAX_JOBS 16
+#define SCHED_MAX_HOSTS 4
+
+class FetchScheduler {
+public:
+  FetchScheduler();
+
+  // Per-host rate limit: min time between two requests to the same host
+  int addHost(const char *name, uint32_t minIntervalMs);
+
+  // ttlMs applies in the background, activeTtlMs while the job's screen is
+  // visible. Jobs that never ran are due immediately.
+  int addJob(const char *name, int host, uint32_t ttlMs,
+             uint32_t activeTtlMs);
+
+  // Active jobs (data on the visible screen) win over background ones
+  void setActive(int job, bool active);
+  bool isActive(int job) const;
+
+  // Make a job due now (manual refresh)
+  void trigger(int job);
+
+  // Picks the job to run at 'now', or -1 if nothing is runnable yet
+  int next(uint32_t now) const;
+
+  // Bookkeeping around a fetch. Failed jobs retry after retryMs instead of
+  // hammering the host on every pass.
+  void begin(int job, uint32_t now);
+  void complete(int job, uint32_t now, bool success);
+
+  // Introspection
+  uint32_t msUntilNext(uint32_t now) const; // 0 = something runnable now
+  uint32_t nextDue(int job, uint32_t now) const; // ms until job is due
+  int queueDepth(uint32_t now) const;            // jobs due right now
+  bool hasRun(int job) const;
+  uint32_t lastSuccess(int job) const;
+  int jobCount() const { return numJobs; }
+  const char *jobName(int job) const;
+  int jobHost(int job) const;
+  int hostCount() const { return numHosts; }
+  const char *hostName(int host) const;
+
+  uint32_t retryMs;
+
+private:
+  struct Host {
+    const char *name;
+    uint32_t minIntervalMs;
+    uint32_t lastRequest;
+    bool used;
+  };
+
+  struct Job {
+    const char *name;
+    int host;
+    uint32_t ttlMs;
+    uint32_t activeTtlMs;
+    uint32_t lastRun;     // Last attempt (success or not)
+    uint32_t lastSuccess; // Last successful fetch
+    bool hasRun;
+    bool succeeded;
+    bool active;
+    bool forced;
+  };
+
+  Host hosts[SCHED_MAX_HOSTS];
+  Job jobs[SCHED_MAX_JOBS];
+  int numHosts;
+  int numJobs;
+
+  uint32_t dueAt(const Job &j) const;
+  uint32_t hostReadyAt(const Host &h) const;
+  static bool reached(uint32_t deadline, uint32_t now) {
+    return (int32_t)(now - deadline) >= 0; // millis() wrap-safe
+  }
+};
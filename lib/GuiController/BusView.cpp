@@ -1,18 +1,19 @@
 #include "BusView.h"
 #include "DataManager.h"
 #include "GuiController.h"
+#include "Theme.h"
 #include <cstdio>
 
-LV_FONT_DECLARE(lv_font_montserrat_14);
-LV_FONT_DECLARE(lv_font_montserrat_20);
-
-static void opa_anim_cb(void *obj, int32_t v) {
-  lv_obj_set_style_opa((lv_obj_t *)obj, v, 0);
-}
-
-lv_color_t BusView::getBusLineColor(const String &line, lv_color_t &textColor) {
-  textColor = lv_color_hex(0xFFFFFF);
+BusView::Widgets BusView::ui = {};
+VirtualList BusView::list;
+BusView::Row BusView::rows[VirtualList::MAX_POOL];
+const BusData *BusView::bus = NULL;
+const DepartureBoard *BusView::board = NULL;
+int BusView::passed = 0;
+uint32_t BusView::tickSec = 0;
 
+// Badge fill per TMB network; the text is white (Theme::busBadgeText)
+lv_color_t BusView::getBusLineColor(const String &line) {
   if (line.startsWith("H"))
     return lv_color_hex(0x002E6E);
   else if (line.startsWith("V"))
@@ -29,183 +30,223 @@ lv_color_t BusView::getBusLineColor(const String &line, lv_color_t &textColor) {
   return lv_color_hex(0xCC0000);
 }
 
-void BusView::show(const BusData &data, int anim) {
-  GuiController::currentApp = GuiController::APP_BUS;
-  Serial.println("BusView: Start Show");
+void BusView::createRow(lv_obj_t *row, int slot) {
+  Row &r = rows[slot];
+  Theme::add(row, &Theme::busRow);
+  Theme::add(row, &Theme::card);
+  Theme::add(row, &Theme::rowBg[slot % 2]);
 
-  lv_obj_t *new_scr = lv_obj_create(NULL);
-  Serial.println("BusView: Screen Created");
-  lv_obj_clean(new_scr);
+  r.badge = lv_obj_create(row);
+  Theme::add(r.badge, &Theme::busBadge);
+  lv_obj_clear_flag(r.badge, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+
+  r.line = lv_label_create(r.badge);
+  Theme::add(r.line, &Theme::busBadgeText);
+
+  lv_obj_t *text = lv_obj_create(row); // Destination over the stop tag
+  Theme::add(text, &Theme::busText);
+  lv_obj_clear_flag(text, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+
+  r.dest = lv_label_create(text);
+  lv_label_set_long_mode(r.dest, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  Theme::add(r.dest, &Theme::busDest);
+
+  r.stop = lv_label_create(text);
+  lv_label_set_long_mode(r.stop, LV_LABEL_LONG_DOT);
+  Theme::add(r.stop, &Theme::busStop);
+  lv_obj_add_flag(r.stop, LV_OBJ_FLAG_HIDDEN);
+
+  r.eta = lv_label_create(row);
+  Theme::add(r.eta, &Theme::busEta);
+}
 
+void BusView::bindRow(lv_obj_t *row, int slot, int i) {
+  Row &r = rows[slot];
+  const BusArrival &arr = bus->arrivals[passed + i];
+
+  if (r.arr != &arr) {
+    r.arr = &arr;
+    r.mins = -1;
+    lv_obj_set_style_bg_color(r.badge, getBusLineColor(arr.line), 0);
+    lv_label_set_text(r.line, arr.line.c_str());
+    lv_label_set_text(r.dest, arr.destination.c_str());
+    if (board) {
+      lv_label_set_text(r.stop, board->stopName(arr.stop).c_str());
+      lv_obj_clear_flag(r.stop, LV_OBJ_FLAG_HIDDEN);
+    } else {
+      lv_obj_add_flag(r.stop, LV_OBJ_FLAG_HIDDEN);
+    }
+  }
+
+  // ETA: only when its minute changed (tick() rebinds every second)
+  int left = BusService::secondsLeft(arr, *bus, millis());
+  int mins = BusService::etaMinutes(left);
+  if (mins == r.mins)
+    return;
+  r.mins = mins;
+  char eta[16];
+  BusService::formatEta(left, eta, sizeof(eta));
+  lv_label_set_text(r.eta, eta);
+
+  // Blink for imminent buses stays disabled (anim crashed on deletion)
+  uint32_t eta_col = 0x00FF00;
+  if (mins <= 2)
+    eta_col = 0xFF4500;
+  else if (mins <= 5)
+    eta_col = 0xFFFF00;
+  lv_obj_set_style_text_color(r.eta, lv_color_hex(eta_col), 0);
+}
+
+int BusView::countPassed(uint32_t nowMs) {
+  // Sorted by ETA, so the passed ones are a prefix
+  int n = 0;
+  while (n < (int)bus->arrivals.size() &&
+         BusService::secondsLeft(bus->arrivals[n], *bus, nowMs) < 0)
+    n++;
+  return n;
+}
+
+void BusView::setRowCount() {
+  int count = bus->arrivals.size() - passed;
+  if (count == 0)
+    lv_obj_clear_flag(ui.empty, LV_OBJ_FLAG_HIDDEN);
+  else
+    lv_obj_add_flag(ui.empty, LV_OBJ_FLAG_HIDDEN);
+  list.setCount(count);
+}
+
+void BusView::onScreenDeleted(lv_event_t *e) {
+  // Dropped by the screen cache (over its heap budget)
+  if (lv_event_get_target(e) == ui.screen)
+    memset(&ui, 0, sizeof(ui));
+}
+
+void BusView::build() {
+  uint32_t heap0 = ESP.getFreeHeap();
+  lv_obj_t *new_scr = lv_obj_create(NULL);
+  ui.screen = new_scr;
+  lv_obj_add_event_cb(new_scr, onScreenDeleted, LV_EVENT_DELETE, NULL);
   lv_obj_add_event_cb(new_scr, GuiController::handleGesture, LV_EVENT_GESTURE,
                       NULL);
   lv_obj_add_event_cb(new_scr, GuiController::handleScreenClick,
                       LV_EVENT_CLICKED, NULL);
 
-  lv_obj_set_style_bg_color(new_scr, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_bg_opa(new_scr, LV_OPA_COVER, 0);
+  Theme::add(new_scr, &Theme::screen);
 
   // HEADER
   lv_obj_t *header = lv_obj_create(new_scr);
-  lv_obj_set_size(header, LV_PCT(100), 40);
-  lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
-  lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0); // Transparent like others
-  lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_set_style_pad_all(header, 5, 0);
+  Theme::add(header, &Theme::header);
   lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_add_flag(header, LV_OBJ_FLAG_EVENT_BUBBLE); // Bubble clicks up
 
-  lv_obj_t *title = lv_label_create(header);
+  ui.title = lv_label_create(header);
+  lv_label_set_long_mode(ui.title, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  Theme::add(ui.title, &Theme::title); // Left Aligned (No Icon)
+
+  // Time (updateTime() fills it in while the screen is active)
+  ui.time = lv_label_create(header);
+  lv_label_set_text(ui.time, "--:--");
+  Theme::add(ui.time, &Theme::clock);
+
+  // Status Dot
+  ui.dot = lv_obj_create(header);
+  Theme::add(ui.dot, &Theme::dot);
+  lv_obj_align_to(ui.dot, ui.time, LV_ALIGN_OUT_LEFT_MID, -7,
+                  0); // Moved right 1px (was -8)
+  lv_obj_clear_flag(ui.dot, LV_OBJ_FLAG_SCROLLABLE);
+
+  // List: every arrival, through a fixed pool of recycled rows
+  lv_obj_t *cont = list.create(new_scr, 280, 44, createRow, bindRow);
+  Theme::add(cont, &Theme::bare);
+  lv_obj_align(cont, LV_ALIGN_TOP_MID, 0, 40);
+  lv_obj_set_style_pad_row(cont, 0, 0);
+  lv_obj_add_flag(cont, LV_OBJ_FLAG_GESTURE_BUBBLE);
+  lv_obj_add_flag(cont, LV_OBJ_FLAG_EVENT_BUBBLE); // Bubble clicks up
+
+  ui.empty = lv_label_create(cont);
+  lv_label_set_text(ui.empty, "No buses found or API Error.");
+  Theme::add(ui.empty, &Theme::textWhite);
+
+  Serial.printf("GUI: Bus built: %u objects, %u B heap\n",
+                GuiController::countObjects(new_scr),
+                (unsigned)(heap0 - ESP.getFreeHeap()));
+}
+
+lv_obj_t *BusView::update(const BusData &data) {
+  if (!ui.screen)
+    build();
+  board = NULL;
   if (data.stopName.length() > 0) {
-    lv_label_set_text(title, GuiController::sanitize(data.stopName).c_str());
+    lv_label_set_text(ui.title, data.stopName.c_str());
   } else {
-    lv_label_set_text_fmt(title, "Stop: %s", data.stopCode.c_str());
+    lv_label_set_text_fmt(ui.title, "Stop: %s", data.stopCode.c_str());
   }
+  show(data);
+  return ui.screen;
+}
 
-  lv_label_set_long_mode(title, LV_LABEL_LONG_SCROLL_CIRCULAR);
-  lv_obj_set_width(title, 160);
-  lv_obj_set_style_text_color(title, lv_color_hex(0x00FFFF), 0); // Cyan
-  // Ensure font is valid or available
-  lv_obj_set_style_text_font(title, &lv_font_montserrat_20, 0); // Font 20
-  Serial.println("BusView: Title Set");
-  lv_obj_align(title, LV_ALIGN_TOP_LEFT, 0, 0); // Left Aligned (No Icon)
-
-  // Time
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 10)) {
-    char timeStr[32];
-    strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-    lv_obj_t *time_lb = lv_label_create(header);
-    lv_label_set_text(time_lb, timeStr);
-    lv_obj_set_style_text_color(time_lb, lv_color_hex(0xAAAAAA), 0); // Grey
-    lv_obj_set_style_text_font(time_lb, &lv_font_montserrat_20, 0);
-    lv_obj_align(time_lb, LV_ALIGN_TOP_RIGHT, 0, 0); // Top aligned
-    GuiController::setActiveTimeLabel(time_lb);
-
-    // Status Dot
-    lv_obj_t *dot = lv_obj_create(header);
-    lv_obj_set_size(dot, 10, 8); // Wider (was 8x8)
-    lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(dot, 0, 0);
-    lv_obj_align_to(dot, time_lb, LV_ALIGN_OUT_LEFT_MID, -7,
-                    0); // Moved right 1px (was -8)
-    lv_obj_clear_flag(dot, LV_OBJ_FLAG_SCROLLABLE);
-
-    uint32_t dotColor = 0x00AA00; // Dark Green
-    if (DataManager::isBusUpdating(GuiController::getBusIndex())) {
-      dotColor = 0xFFFF00; // Yellow
-    } else if (data.lastUpdate == 0 ||
-               (millis() - data.lastUpdate > 60000)) { // 60s Stale
-      dotColor = 0xFF0000;                             // Red
-    }
-    lv_obj_set_style_bg_color(dot, lv_color_hex(dotColor), 0);
-    Serial.println("BusView: Time & Dot Created");
+lv_obj_t *BusView::updateBoard(const DepartureBoard &merged) {
+  if (!ui.screen)
+    build();
+  board = &merged;
+  lv_label_set_text_fmt(ui.title, "All stops (%d)",
+                        GuiController::busStopCount);
+  show(merged.data());
+  return ui.screen;
+}
+
+void BusView::show(const BusData &data) {
+  bus = &data;
+
+  // New vector: rebind every row in full
+  for (int i = 0; i < VirtualList::MAX_POOL; i++)
+    rows[i].arr = NULL;
+  uint32_t now = millis();
+  tickSec = (now - data.lastUpdate) / 1000;
+  passed = countPassed(now);
+  setRowCount();
+
+  refreshStatus();
+}
+
+void BusView::tick() {
+  // Flash data has no time base: shown as fetched
+  if (!ui.screen || bus->lastUpdate == 0)
+    return;
+  uint32_t now = millis();
+  uint32_t sec = (now - bus->lastUpdate) / 1000;
+  if (sec == tickSec)
+    return; // Once per second
+  tickSec = sec;
+
+  int gone = countPassed(now);
+  if (gone != passed) {
+    passed = gone; // Rows shift up: rebinds them
+    setRowCount();
   } else {
-    Serial.println("BusView: Time Skipped (No NTP)");
+    list.refresh(); // Touches only the ETAs whose minute changed
   }
+}
 
-  // List
-  lv_obj_t *list = lv_obj_create(new_scr);
-  Serial.println("BusView: List Created");
-  lv_obj_set_size(list, LV_PCT(100), 280);
-  lv_obj_align(list, LV_ALIGN_TOP_MID, 0, 40);
-  lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_style_bg_color(list, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_border_width(list, 0, 0);
-  lv_obj_set_style_pad_all(list, 0, 0);
-  lv_obj_set_style_pad_row(list, 0, 0);
-  lv_obj_add_flag(list, LV_OBJ_FLAG_GESTURE_BUBBLE);
-  lv_obj_add_flag(list, LV_OBJ_FLAG_EVENT_BUBBLE); // Bubble clicks up
-
-  if (data.arrivals.empty()) {
-    lv_obj_t *lbl = lv_label_create(list);
-    lv_label_set_text(lbl, "No buses found or API Error.");
-    lv_obj_set_style_text_color(lbl, lv_color_hex(0xFFFFFF), 0);
-    Serial.println("BusView: Empty List");
+void BusView::refreshStatus() {
+  if (!ui.screen)
+    return;
+  // Board: any stop fetching, and the stalest stop decides
+  bool updating = false;
+  if (board) {
+    for (int i = 0; i < board->stopCount(); i++)
+      updating |= DataManager::isBusUpdating(i);
   } else {
-    int idx = 0;
-    int limit = 6;
-    for (const auto &arr : data.arrivals) {
-      if (idx >= limit)
-        break;
-
-      lv_obj_t *row = lv_obj_create(list);
-      if (!row)
-        break;
-      lv_obj_set_size(row, LV_PCT(100), 44);
-      lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-      lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER,
-                            LV_FLEX_ALIGN_CENTER);
-      lv_obj_add_flag(row, LV_OBJ_FLAG_EVENT_BUBBLE); // Bubble clicks from row
-
-      uint32_t bg_col =
-          (idx % 2 == 0) ? 0x101010 : 0x202020; // 333333 -> 202020
-      lv_obj_set_style_bg_color(row, lv_color_hex(bg_col), 0);
-      lv_obj_set_style_border_width(row, 2, 0); // Increased 1->2
-      lv_obj_set_style_border_color(row, lv_color_hex(0x777777), 0);
-      lv_obj_set_style_border_opa(row, LV_OPA_70, 0);
-      lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
-      lv_obj_set_style_pad_all(row, 5, 0);
-      lv_obj_set_style_pad_column(row, 8, 0);
-
-      lv_color_t txtCol;
-      lv_color_t badgeCol = getBusLineColor(arr.line, txtCol);
-
-      lv_obj_t *lineBox = lv_obj_create(row);
-      lv_obj_set_size(lineBox, 40, 28);
-      lv_obj_set_style_bg_color(lineBox, badgeCol, 0);
-      lv_obj_set_style_radius(lineBox, 4, 0);
-      lv_obj_set_style_border_width(lineBox, 0, 0);
-      lv_obj_clear_flag(lineBox,
-                        LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-
-      lv_obj_t *lineLbl = lv_label_create(lineBox);
-      lv_label_set_text(lineLbl, arr.line.c_str());
-      lv_obj_center(lineLbl);
-      lv_obj_set_style_text_color(lineLbl, txtCol, 0);
-      lv_obj_set_style_text_font(lineLbl, &lv_font_montserrat_14, 0);
-
-      lv_obj_t *dest = lv_label_create(row);
-      lv_label_set_text(dest, GuiController::sanitize(arr.destination).c_str());
-      lv_obj_set_flex_grow(dest, 1);
-      lv_label_set_long_mode(dest, LV_LABEL_LONG_SCROLL_CIRCULAR);
-      lv_obj_set_style_text_color(dest, lv_color_hex(0xDDDDDD), 0);
-      lv_obj_set_style_text_font(dest, &lv_font_montserrat_14, 0);
-
-      lv_obj_t *timeLbl = lv_label_create(row);
-      lv_label_set_text(timeLbl, arr.text.c_str());
-      lv_obj_set_width(timeLbl, 55);
-      lv_obj_set_style_text_align(timeLbl, LV_TEXT_ALIGN_RIGHT, 0);
-      lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_14, 0);
-
-      uint32_t eta_col = 0x00FF00;
-      int mins = arr.seconds / 60;
-      if (mins <= 2) {
-        eta_col = 0xFF4500;
-        lv_anim_t a;
-        lv_anim_init(&a);
-        lv_anim_set_var(&a, timeLbl);
-        lv_anim_set_values(&a, LV_OPA_COVER, LV_OPA_40);
-        lv_anim_set_time(&a, 800);
-        lv_anim_set_playback_delay(&a, 100);
-        lv_anim_set_playback_time(&a, 500);
-        lv_anim_set_repeat_delay(&a, 100);
-        // lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
-        // lv_anim_set_exec_cb(&a, opa_anim_cb);
-        // lv_anim_start(&a);
-        // FIX: Anim disabled to prevent crash on deletion
-      } else if (mins <= 5)
-        eta_col = 0xFFFF00;
-      lv_obj_set_style_text_color(timeLbl, lv_color_hex(eta_col), 0);
-
-      idx++;
-    }
+    updating = DataManager::isBusUpdating(GuiController::getBusIndex());
   }
-
-  // Manual switch to bypass Animation Engine crash
-  lv_obj_t *old_scr = lv_scr_act();
-  lv_scr_load(new_scr);
-  if (old_scr) {
-    lv_obj_del(old_scr);
+  uint32_t last = board ? board->oldestUpdate() : bus->lastUpdate;
+
+  uint32_t dotColor = 0x00AA00; // Dark Green
+  if (updating) {
+    dotColor = 0xFFFF00; // Yellow
+  } else if (last == 0 || (millis() - last >
+                           DataManager::BUS_ACTIVE_TTL_MS + 30000)) {
+    dotColor = 0xFF0000; // Red: poll overdue
   }
+  lv_obj_set_style_bg_color(ui.dot, lv_color_hex(dotColor), 0);
 }
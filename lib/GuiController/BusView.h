@@ -1,15 +1,67 @@
 #pragma once
 
 #include "BusService.h"
+#include "DepartureBoard.h"
+#include "VirtualList.h"
 #include "lvgl.h"
 #include "weather_icons.h"
 #include <Arduino.h>
 
 
+// Arrivals scroll through a VirtualList, so a stop with many lines costs
+// the same row objects as one with three. The screen is built once and
+// kept; update() pushes new data into it whether it is shown or not.
+// Between fetches tick() counts the ETAs down from the response time.
+// The merged departures board renders through the same rows, each tagged
+// with its stop.
 class BusView {
 public:
-  static void show(const BusData &data, int anim);
+  // Builds the screen if needed and returns it (not loaded); rows keep
+  // referring to `data` (see VirtualList::BindRowCb)
+  static lv_obj_t *update(const BusData &data);
+  // Same for the merged board: call again after every board change
+  static lv_obj_t *updateBoard(const DepartureBoard &board);
+  static bool shows(const BusData &data) { return ui.screen && bus == &data; }
+  static void refreshStatus(); // Status dot only
+  // Call often (GUI loop): once a second it updates the ETAs whose minute
+  // changed and drops the arrivals that have passed
+  static void tick();
+
+  static lv_obj_t *screen() { return ui.screen; } // NULL until built
+  static lv_obj_t *timeLabel() { return ui.time; }
 
 private:
-  static lv_color_t getBusLineColor(const String &line, lv_color_t &textColor);
+  // Handles, valid while screen != NULL
+  struct Widgets {
+    lv_obj_t *screen;
+    lv_obj_t *title;
+    lv_obj_t *time;
+    lv_obj_t *dot;
+    lv_obj_t *empty; // "No buses" label
+  };
+  struct Row {
+    lv_obj_t *badge;
+    lv_obj_t *line;
+    lv_obj_t *dest;
+    lv_obj_t *stop; // Board only: stop tag under the destination
+    lv_obj_t *eta;
+    const BusArrival *arr; // Bound arrival, NULL = rebind in full
+    int mins;              // Minute shown in eta
+  };
+  static Widgets ui;
+  static VirtualList list;
+  static Row rows[VirtualList::MAX_POOL]; // Per pool slot
+  static const BusData *bus;
+  static const DepartureBoard *board; // NULL: a single stop
+  static int passed;       // Leading arrivals already gone (not listed)
+  static uint32_t tickSec; // Seconds since the response, last tick
+
+  static void build();
+  static void show(const BusData &data);
+  static int countPassed(uint32_t nowMs);
+  static void setRowCount();
+  static void onScreenDeleted(lv_event_t *e);
+  static void createRow(lv_obj_t *row, int slot);
+  static void bindRow(lv_obj_t *row, int slot, int i);
+  static lv_color_t getBusLineColor(const String &line);
 };
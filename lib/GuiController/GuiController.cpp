@@ -1,6 +1,8 @@
 #include "GuiController.h"
 #include "BusService.h"
+#include "DataManager.h"
 #include "NetworkManager.h"
+#include "Theme.h"
 #include "WeatherService.h"
 #include <Arduino.h>
 #include <TFT_eSPI.h>
@@ -10,19 +12,75 @@
 // --- SCREEN DRIVER SETUP ---
 static const uint16_t screenWidth = 240;
 static const uint16_t screenHeight = 320;
+static const uint16_t drawBufLines = 30;
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[screenWidth * 60];
+// Two stripes in internal (DMA-capable) RAM: LVGL renders into one while
+// the other is on the SPI bus. Same 28.8 KB as the old single 60-line buffer.
+static lv_color_t buf1[screenWidth * drawBufLines];
+static lv_color_t buf2[screenWidth * drawBufLines];
 TFT_eSPI tft = TFT_eSPI();
 
+// Swipe/tap to first pixel: gesture -> screen load issued -> first stripe
+// of the new screen flushed (see navigate, loadScreen)
+static uint32_t switchStartUs = 0; // Gesture time, 0 = none pending
+static uint32_t switchLoadUs = 0;
+static uint32_t switchPixelUs = 0;
+static bool switchBuilt = false; // Target screen was not resident
+
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area,
                    lv_color_t *color_p) {
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
-  tft.startWrite();
-  tft.setAddrWindow(area->x1, area->y1, w, h);
-  tft.pushColors((uint16_t *)&color_p->full, w * h, true);
-  tft.endWrite();
+  // pushImageDMA() first waits for the previous stripe's DMA to complete,
+  // then starts this one and returns. Reporting ready here lets LVGL render
+  // the next stripe into the other buffer while this one is transferred;
+  // that buffer is only reused after its own transfer has completed.
+  tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t *)&color_p->full);
   lv_disp_flush_ready(disp);
+  if (switchStartUs && switchLoadUs && !switchPixelUs)
+    switchPixelUs = micros() - switchStartUs;
+}
+
+// Render time of the refresh following a view update (see showWeatherScreen)
+static volatile bool traceRender = false;
+
+// Frame-time counter: 1 s windows, logged only when they contain
+// full-screen refreshes (screen transitions)
+static uint32_t frameWindowStart = 0;
+static uint16_t frameCount = 0, frameFull = 0;
+static uint32_t frameTimeSum = 0, frameTimeMax = 0;
+
+void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+  if (traceRender) {
+    traceRender = false;
+    Serial.printf("GUI: Render %u ms, %u px redrawn\n", (unsigned)time,
+                  (unsigned)px);
+  }
+  if (switchPixelUs) {
+    Serial.printf("GUI: Switch to first pixel %u us (load issued at %u us, "
+                  "%s screen), first frame %u ms\n",
+                  (unsigned)switchPixelUs, (unsigned)switchLoadUs,
+                  switchBuilt ? "built" : "resident", (unsigned)time);
+    switchStartUs = switchLoadUs = switchPixelUs = 0;
+  }
+
+  uint32_t now = millis();
+  if (now - frameWindowStart >= 1000) {
+    if (frameFull)
+      Serial.printf("GUI: %u fps, frame avg %u ms max %u ms (%u full-screen)\n",
+                    (unsigned)(frameCount * 1000UL / (now - frameWindowStart)),
+                    (unsigned)(frameTimeSum / frameCount),
+                    (unsigned)frameTimeMax, frameFull);
+    frameWindowStart = now;
+    frameCount = frameFull = 0;
+    frameTimeSum = frameTimeMax = 0;
+  }
+  frameCount++;
+  frameTimeSum += time;
+  if (time > frameTimeMax)
+    frameTimeMax = time;
+  if (px >= (uint32_t)screenWidth * screenHeight)
+    frameFull++;
 }
 
 // --- STATE VARIABLES ---
@@ -33,7 +91,14 @@ int GuiController::currentBusIndex = 0;
 int GuiController::busStopCount = 1;
 bool GuiController::busStationChanged = false;
 int GuiController::getBusIndex() { return currentBusIndex; }
-void GuiController::setBusStopCount(int count) { busStopCount = count; }
+bool GuiController::isBusBoard() {
+  return busStopCount > 1 && currentBusIndex == busStopCount;
+}
+void GuiController::setBusStopCount(int count) {
+  busStopCount = count;
+  if (count > 1)
+    currentBusIndex = count; // Start on the merged board
+}
 bool GuiController::hasBusStationChanged() { return busStationChanged; }
 void GuiController::clearBusStationChanged() { busStationChanged = false; }
 
@@ -47,174 +112,460 @@ bool GuiController::hasCityChanged() { return cityChanged; }
 void GuiController::clearCityChanged() { cityChanged = false; }
 
 bool GuiController::isBusScreenActive() { return currentApp == APP_BUS; }
-void GuiController::updateBusCache(const BusData &data) { cachedBus = data; }
 bool GuiController::isStockScreenActive() { return currentApp == APP_STOCK; }
+
+void GuiController::updateWeatherCache(const WeatherData &data) {
+  cachedWeather = data;
+  WeatherView::refresh(cachedWeather);
+}
+
+void GuiController::updateBusCache(const BusData &data) {
+  cachedBus = data;
+  if (BusView::shows(cachedBus))
+    BusView::update(cachedBus);
+}
+
+const BusData &GuiController::busShown() {
+  return isBusBoard() ? board.data() : cachedBus;
+}
+
+lv_obj_t *GuiController::updateBusView() {
+  if (isBusBoard())
+    return BusView::updateBoard(board);
+  return BusView::update(cachedBus);
+}
+
+void GuiController::mergeBusStops(uint32_t stops) {
+  if (busStopCount < 2)
+    return; // No board for a single stop
+  uint32_t now = millis();
+  int n = busStopCount < BUS_MAX_STOPS ? busStopCount : BUS_MAX_STOPS;
+  if (stops & (stops - 1)) {
+    // Several stops at once (boot cache): one k-way merge over all of them
+    const BusData *all[BUS_MAX_STOPS] = {};
+    for (int i = 0; i < n; i++) {
+      if ((stops & (1u << i)) || board.hasStop(i))
+        all[i] = &DataManager::getBusStopData(i);
+    }
+    board.rebuild(all, n, now);
+  } else {
+    for (int i = 0; i < n; i++) {
+      if (stops & (1u << i))
+        board.updateStop(i, DataManager::getBusStopData(i), now);
+    }
+  }
+  // Board rows point into it: rebind whenever it is on the screen
+  if (BusView::shows(board.data()))
+    BusView::updateBoard(board);
+  else if (isBusBoard() && isBusScreenActive())
+    showBusScreen(board.data());
+}
+
 void GuiController::updateStockCache(const std::vector<StockItem> &data) {
   cachedStock = data;
+  if (StockView::screen())
+    StockView::update(cachedStock);
 }
 
 // Queue & Cache
-String GuiController::pendingMsg = "";
-bool GuiController::needsUpdate = false;
-SemaphoreHandle_t GuiController::guiMutex = NULL;
+QueueHandle_t GuiController::cmdQueue = NULL;
+TaskHandle_t GuiController::guiTaskHandle = NULL;
+bool GuiController::hwGestures = false;
+uint32_t GuiController::lastSwGestureMs = 0;
 WeatherData GuiController::cachedWeather;
 BusData GuiController::cachedBus;
+DepartureBoard GuiController::board;
 std::vector<StockItem> GuiController::cachedStock;
 
 // Local Controller State
 static lv_obj_t *activeTimeLabel = NULL;
+static uint32_t lastTimeUpdate = 0;
 static int forecastMode = 0; // 0: Current, 1: Hourly, 2: Daily, 3: Chart
-
-// Custom Font
-LV_FONT_DECLARE(font_intl_16);
+static bool appShown = false; // An app screen has replaced the boot screen
+static lv_obj_t *loadingScr = NULL;
+static lv_obj_t *loadingLabel = NULL;
 
 void GuiController::init() {
-  guiMutex = xSemaphoreCreateMutex();
+  cmdQueue = xQueueCreate(8, sizeof(GuiCommand));
   lv_init();
   tft.begin();
   tft.setRotation(0);
-  lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * 30);
+  tft.initDMA();
+  tft.setSwapBytes(true); // LV_COLOR_16_SWAP stays 0 for the icon data
+  tft.startWrite();       // Keep the bus (CS low) for DMA; display only
+  lv_disp_draw_buf_init(&draw_buf, buf1, buf2, screenWidth * drawBufLines);
   static lv_disp_drv_t disp_drv;
   lv_disp_drv_init(&disp_drv);
   disp_drv.hor_res = screenWidth;
   disp_drv.ver_res = screenHeight;
   disp_drv.flush_cb = my_disp_flush;
+  disp_drv.monitor_cb = my_disp_monitor;
   disp_drv.draw_buf = &draw_buf;
-  lv_disp_drv_register(&disp_drv);
+  lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+
+  // Frame budget: refresh at GUI_FRAME_MS instead of LV_DISP_DEF_REFR_PERIOD
+  lv_timer_set_period(disp->refr_timer, GUI_FRAME_MS);
+
+  Theme::init(); // Shared view styles, before the first screen
 
   Serial.println("GuiController: LVGL initialized. Standard fonts linked.");
 }
 
+void GuiController::begin() {
+  xTaskCreatePinnedToCore(guiTask, "GuiTask", 8192, NULL, 2, &guiTaskHandle,
+                          GUI_TASK_CORE);
+}
+
+void GuiController::wake() {
+  GuiCommand cmd = {CMD_WAKE, "", 0, 0, false};
+  xQueueSend(cmdQueue, &cmd, 0); // Full queue: the task is awake anyway
+}
+
+void IRAM_ATTR GuiController::wakeFromTouchISR() {
+  GuiCommand cmd = {CMD_TOUCH, "", 0, 0, false};
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(cmdQueue, &cmd, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
+}
+
 void GuiController::showLoadingScreen(const char *msg) {
-  if (xSemaphoreTake(guiMutex, portMAX_DELAY) == pdTRUE) {
-    if (msg)
-      pendingMsg = String(msg);
-    else
-      pendingMsg = "Loading...";
-    needsUpdate = true;
-    xSemaphoreGive(guiMutex);
+  GuiCommand cmd = {CMD_LOADING, "", 0, 0, false};
+  strlcpy(cmd.msg, msg ? msg : "Loading...", sizeof(cmd.msg));
+  xQueueSend(cmdQueue, &cmd, portMAX_DELAY);
+}
+
+void GuiController::postGesture(TouchGesture g, bool scrolled) {
+  GuiCommand cmd = {CMD_GESTURE, "", (uint8_t)g, (uint32_t)micros(),
+                    scrolled};
+  xQueueSend(cmdQueue, &cmd, 0);
+}
+
+void GuiController::handleCommand(const GuiCommand &cmd) {
+  if (cmd.type == CMD_LOADING) {
+    drawLoadingScreen(cmd.msg);
+  } else if (cmd.type == CMD_TOUCH) {
+    // Run the indev read in this lv_timer_handler() pass
+    lv_indev_t *indev = lv_indev_get_next(NULL);
+    if (indev)
+      lv_timer_ready(indev->driver->read_timer);
+  } else if (cmd.type == CMD_GESTURE) {
+    TouchGesture g = (TouchGesture)cmd.arg;
+    Serial.printf("GUI: HW gesture %s%s\n", TouchDrv::gestureName(g),
+                  cmd.scrolled ? " (scrolled a list, ignored)" : "");
+    if (g > GESTURE_SWIPE_RIGHT || cmd.scrolled)
+      return; // Taps reach the widgets through LVGL click events
+    if (!hwGestures) {
+      // First hardware swipe: from now on it replaces software detection.
+      // Skip it if LVGL already acted on this same swipe.
+      hwGestures = true;
+      if (millis() - lastSwGestureMs < 500)
+        return;
+    }
+    static const lv_dir_t dirs[] = {LV_DIR_NONE, LV_DIR_TOP, LV_DIR_BOTTOM,
+                                    LV_DIR_LEFT, LV_DIR_RIGHT};
+    navigate(dirs[g], cmd.us);
   }
+  // CMD_WAKE: nothing to do, syncData() runs next
 }
 
-void GuiController::update() {
-  if (needsUpdate) {
-    if (xSemaphoreTake(guiMutex, 5) == pdTRUE) {
-      if (needsUpdate) { // Double check inside lock
-        needsUpdate = false;
-        drawLoadingScreen(pendingMsg.c_str());
-      }
-      xSemaphoreGive(guiMutex);
+// --- GUI TASK ---
+// Owns every LVGL call after begin(): view commands and data events are
+// handled between lv_timer_handler() runs. While nothing is invalidated or
+// animating the refresh timer is paused and the task blocks on the command
+// queue until the next LVGL timer (touch polling) or a command is due.
+void GuiController::guiTask(void *parameter) {
+  lv_disp_t *disp = lv_disp_get_default();
+  uint32_t sleepMs = 0;
+
+  for (;;) {
+    GuiCommand cmd;
+    if (xQueueReceive(cmdQueue, &cmd, pdMS_TO_TICKS(sleepMs)) == pdTRUE) {
+      handleCommand(cmd);
+      while (xQueueReceive(cmdQueue, &cmd, 0) == pdTRUE)
+        handleCommand(cmd);
+    }
+
+    syncData();
+    updateTime();
+    if (currentApp == APP_BUS)
+      BusView::tick();
+
+    if (disp->inv_p || lv_anim_count_running())
+      lv_timer_resume(disp->refr_timer);
+    uint32_t next = lv_timer_handler();
+
+    // Invalidated during the handler (touch scroll, click): next frame
+    bool busy = disp->inv_p || lv_anim_count_running();
+    if (busy) {
+      lv_timer_resume(disp->refr_timer);
+      sleepMs = next < GUI_FRAME_MS ? next : GUI_FRAME_MS;
+    } else {
+      lv_timer_pause(disp->refr_timer);
+      sleepMs = next < GUI_IDLE_MS ? next : GUI_IDLE_MS;
+      maintainScreens();
     }
   }
-  lv_timer_handler();
 }
 
-void GuiController::drawLoadingScreen(const char *msg) {
-  lv_obj_t *scr = lv_scr_act();
-  lv_obj_clean(scr);
-  activeTimeLabel = NULL;
-
-  lv_obj_set_style_bg_color(scr, lv_color_hex(0x0000AA), 0);
-  lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
-
-  lv_obj_t *label = lv_label_create(scr);
-  lv_label_set_text(label, msg ? msg : "Loading...");
-  lv_obj_align(label, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_style_text_color(label, lv_color_hex(0xFFFFFF), 0);
-  // Note: Fonts are declared in Views now, but we can assume default or
-  // montserrat if available globally. Ideally Views handle all drawing. But for
-  // loading screen, default font is fine or reuse montserrat if declared here.
-  // For safety, let's use default font or declare one locally if needed.
-  // Actually, let's just use default LVGL font for Loading to avoid
-  // dependency/declaration mess or rely on what's available.
-}
-
-void GuiController::handle(uint32_t ms) {
-  uint32_t start = millis();
-  while (millis() - start < ms) {
-    lv_timer_handler();
-    delay(5);
+void GuiController::syncData() {
+  // Drain the network task's event queue, then redraw each affected screen
+  // at most once from the latest snapshot.
+  bool weatherReady = false, busReady = false, stockReady = false;
+  bool weatherStatus = false, busStatus = false, stockStatus = false;
+  uint32_t boardStops = 0;
+  DataEvent ev;
+  while (DataManager::pollEvent(ev)) {
+    bool ready = (ev.type == EVT_DATA_READY);
+    bool cached = (ev.type == EVT_CACHE_UPDATED); // Background index
+    switch (ev.source) {
+    case SRC_WEATHER:
+      if (ready && ev.index == getCityIndex())
+        weatherReady = true;
+      else if (!ready) // Started/failed/cached: repaint the status dot
+        weatherStatus = true;
+      break;
+    case SRC_BUS:
+      if (ready || cached) // Every stop feeds the board
+        boardStops |= 1u << ev.index;
+      if (ready && ev.index == getBusIndex())
+        busReady = true;
+      else if (!ready)
+        busStatus = true;
+      break;
+    case SRC_STOCK:
+      if (ready)
+        stockReady = true;
+      else
+        stockStatus = true;
+      break;
+    }
   }
+
+  // Hidden resident screens are updated too, so switching to them later is
+  // only a screen load. Status events just repaint the dots.
+
+  // 1. Weather Update
+  if (weatherReady) {
+    if (currentApp == APP_WEATHER)
+      showWeatherScreen(DataManager::getWeatherData());
+    else
+      updateWeatherCache(DataManager::getWeatherData());
+  } else if (weatherStatus) {
+    // No screen yet (e.g. the first fetch failed): leave the loading screen
+    if (currentApp == APP_WEATHER && !WeatherView::screen(forecastMode))
+      showWeatherScreen(DataManager::getWeatherData());
+    else
+      WeatherView::refreshStatus();
+  }
+
+  // 2. Bus Update
+  if (boardStops)
+    mergeBusStops(boardStops);
+  if (busReady) {
+    if (isBusScreenActive())
+      showBusScreen(DataManager::getBusData());
+    else
+      updateBusCache(DataManager::getBusData());
+  } else if (busStatus) {
+    BusView::refreshStatus();
+  }
+
+  // 3. Stock Update
+  if (stockReady) {
+    if (isStockScreenActive())
+      showStockScreen(DataManager::getStockData());
+    else
+      updateStockCache(DataManager::getStockData());
+  } else if (stockStatus) {
+    StockView::refreshStatus();
+  }
+
+  // Detect App Switching (Force Update on Entry)
+  static bool wasBusActive = false;
+  bool isBus = isBusScreenActive();
+  if (isBus && !wasBusActive) {
+    Serial.println("GUI: Switched to Bus App -> Forcing Update");
+    DataManager::triggerBusUpdate();
+  }
+  wasBusActive = isBus;
 }
 
-String GuiController::sanitize(const String &text) {
-  // Replace multi-byte UTF-8 sequences with single ASCII chars
-  // Return by value (String) is thread-safe (stack memory)
+static void onLoadingDeleted(lv_event_t *e) {
+  loadingScr = NULL;
+  loadingLabel = NULL;
+}
 
-  String buf = text;
+void GuiController::drawLoadingScreen(const char *msg) {
+  // Drawn on LVGL's boot screen, or on a screen of its own once an app
+  // screen replaced it: never on a resident view screen.
+  if (!loadingScr) {
+    loadingScr = appShown ? lv_obj_create(NULL) : lv_scr_act();
+    lv_obj_clean(loadingScr);
+    lv_obj_add_event_cb(loadingScr, onLoadingDeleted, LV_EVENT_DELETE, NULL);
+    lv_obj_set_style_bg_color(loadingScr, lv_color_hex(0x0000AA), 0);
+    lv_obj_set_style_bg_opa(loadingScr, LV_OPA_COVER, 0);
+
+    // Default LVGL font: the view fonts are declared in the Views
+    loadingLabel = lv_label_create(loadingScr);
+    lv_obj_align(loadingLabel, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_text_color(loadingLabel, lv_color_hex(0xFFFFFF), 0);
+  }
+  lv_label_set_text(loadingLabel, msg ? msg : "Loading...");
+  loadScreen(loadingScr, NULL, LV_SCR_LOAD_ANIM_NONE);
+}
 
-  // c-cedilla
-  buf.replace("\xC3\xA7", "c"); // ç
-  buf.replace("\xC3\x87", "C"); // Ç
+// --- DELEGATED VIEW METHODS ---
 
-  // n-tilde
-  buf.replace("\xC3\xB1", "n"); // ñ
-  buf.replace("\xC3\x91", "N"); // Ñ
+void GuiController::showWeatherScreen(const WeatherData &data,
+                                      lv_scr_load_anim_t anim) {
+  currentApp = APP_WEATHER;
+  lv_obj_t *scr = WeatherView::screen(forecastMode);
+  switchBuilt = (scr == NULL);
+  if (scr && &data == &cachedWeather) {
+    WeatherView::refreshStatus(); // Resident and current: just load it
+  } else {
+    if (&data != &cachedWeather)
+      cachedWeather = data;
+    scr = WeatherView::update(cachedWeather, forecastMode);
+  }
+  loadScreen(scr, WeatherView::timeLabel(forecastMode), anim);
+  traceRender = true;
+
+  // Time-to-first-screen: the cached (flash) screen vs the first live one
+  static bool firstShown = false, firstLive = false;
+  if (!firstShown || (!firstLive && data.lastUpdate != 0)) {
+    Serial.printf("BOOT: first %s weather screen at %u ms\n",
+                  data.lastUpdate != 0 ? "live" : "cached",
+                  (unsigned)millis());
+    firstShown = true;
+    firstLive = data.lastUpdate != 0;
+  }
+}
 
-  // a-grave/acute
-  buf.replace("\xC3\xA0", "a"); // à
-  buf.replace("\xC3\xA1", "a"); // á
-  buf.replace("\xC3\x80", "A"); // À
-  buf.replace("\xC3\x81", "A"); // Á
+void GuiController::showBusScreen(const BusData &data,
+                                  lv_scr_load_anim_t anim) {
+  currentApp = APP_BUS;
+  lv_obj_t *scr = BusView::screen();
+  switchBuilt = (scr == NULL);
+  if (scr && BusView::shows(data)) {
+    BusView::refreshStatus(); // Resident and current: just load it
+    BusView::tick();          // ETAs counted on while hidden
+  } else {
+    if (&data != &cachedBus && &data != &board.data())
+      cachedBus = data;
+    scr = updateBusView(); // Rows bind from the cache/board on scroll
+  }
+  loadScreen(scr, BusView::timeLabel(), anim);
+}
 
-  // e-grave/acute
-  buf.replace("\xC3\xA8", "e"); // è
-  buf.replace("\xC3\xA9", "e"); // é
-  buf.replace("\xC3\x88", "E"); // È
-  buf.replace("\xC3\x89", "E"); // É
+void GuiController::showStockScreen(const std::vector<StockItem> &data,
+                                    lv_scr_load_anim_t anim) {
+  currentApp = APP_STOCK;
+  lv_obj_t *scr = StockView::screen();
+  switchBuilt = (scr == NULL);
+  if (scr && &data == &cachedStock) {
+    StockView::refreshStatus(); // Resident and current: just load it
+  } else {
+    if (&data != &cachedStock)
+      cachedStock = data;
+    scr = StockView::update(cachedStock);
+  }
+  loadScreen(scr, StockView::timeLabel(), anim);
+}
 
-  // i-acute/dieresis
-  buf.replace("\xC3\xAD", "i"); // í
-  buf.replace("\xC3\xAF", "i"); // ï
-  buf.replace("\xC3\x8D", "I"); // Í
-  buf.replace("\xC3\x8F", "I"); // Ï
+// --- SCREEN CACHE ---
 
-  // o-grave/acute
-  buf.replace("\xC3\xB2", "o"); // ò
-  buf.replace("\xC3\xB3", "o"); // ó
-  buf.replace("\xC3\x92", "O"); // Ò
-  buf.replace("\xC3\x93", "O"); // Ó
+void GuiController::loadScreen(lv_obj_t *scr, lv_obj_t *timeLabel,
+                               lv_scr_load_anim_t anim) {
+  setActiveTimeLabel(timeLabel);
+  if (scr != loadingScr)
+    appShown = true;
+  if (scr == lv_scr_act()) {
+    switchStartUs = 0; // Updated in place, nothing to trace
+    return;
+  }
 
-  // u-acute/dieresis
-  buf.replace("\xC3\xBA", "u"); // ú
-  buf.replace("\xC3\xBC", "u"); // ü
-  buf.replace("\xC3\x9A", "U"); // Ú
-  buf.replace("\xC3\x9C", "U"); // Ü
+  // No auto_del: over budget, maintainScreens() drops the outgoing screen
+  // once idle. Deleting it at the end of the animation would free it under
+  // a swipe back that lands mid-animation.
+  lv_scr_load_anim(scr, anim, anim == LV_SCR_LOAD_ANIM_NONE ? 0 : 300, 0,
+                   false);
 
-  return buf;
+  // Render the first frame in this lv_timer_handler() pass
+  lv_timer_ready(lv_disp_get_default()->refr_timer);
+  if (switchStartUs)
+    switchLoadUs = micros() - switchStartUs;
 }
 
-// --- DELEGATED VIEW METHODS ---
+bool GuiController::keepScreens() {
+  // Hysteresis: once over budget, resume caching only with 50% headroom
+  static bool kept = true;
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t min = kept ? GUI_SCREEN_HEAP_MIN : GUI_SCREEN_HEAP_MIN * 3 / 2;
+  bool keep = GUI_RESIDENT_SCREENS && freeHeap >= min;
+  if (keep != kept && GUI_RESIDENT_SCREENS)
+    Serial.printf("GUI: Screen cache %s (%u B free)\n",
+                  keep ? "on" : "off, rebuilding on demand",
+                  (unsigned)freeHeap);
+  kept = keep;
+  return keep;
+}
 
-void GuiController::showWeatherScreen(const WeatherData &data, int anim) {
-  Serial.printf("GUI: Show Weather (Free Heap: %d)\n", ESP.getFreeHeap());
-  activeTimeLabel = NULL; // CRITICAL: Reset pointer before transition
-  if (&data != &cachedWeather)
-    cachedWeather = data;
-  WeatherView::show(data, anim, forecastMode);
-  // activeTimeLabel will be updated by WeatherView::show if successful
+void GuiController::dropHiddenScreens() {
+  lv_disp_t *d = lv_disp_get_default();
+  lv_obj_t *screens[] = {WeatherView::screen(0), WeatherView::screen(1),
+                         WeatherView::screen(2), BusView::screen(),
+                         StockView::screen()};
+  for (lv_obj_t *scr : screens) {
+    // Never the active one or one still animating
+    if (scr && scr != d->act_scr && scr != d->prev_scr &&
+        scr != d->scr_to_load) {
+      Serial.printf("GUI: Dropped hidden screen, %u objects\n",
+                    countObjects(scr));
+      lv_obj_del(scr);
+    }
+  }
 }
 
-void GuiController::showBusScreen(const BusData &data, int anim) {
-  Serial.printf("GUI: Show Bus (Free Heap: %d)\n", ESP.getFreeHeap());
-  activeTimeLabel = NULL; // CRITICAL: Reset pointer before transition
-  if (&data != &cachedBus)
-    cachedBus = data;
-  BusView::show(data, anim);
+void GuiController::maintainScreens() {
+  // Only after boot. Within budget, build one missing screen per idle pass
+  // so input stays responsive; over it, drop every hidden one.
+  if (!appShown || lv_scr_act() == loadingScr)
+    return;
+  if (!keepScreens()) {
+    dropHiddenScreens();
+    return;
+  }
+  if (!BusView::screen()) {
+    updateBusView();
+    return;
+  }
+  if (!StockView::screen()) {
+    StockView::update(cachedStock);
+    return;
+  }
+  for (int m = 0; m < WeatherView::MODE_COUNT; m++) {
+    if (!WeatherView::screen(m)) {
+      WeatherView::update(cachedWeather, m);
+      return;
+    }
+  }
 }
 
-void GuiController::showStockScreen(const std::vector<StockItem> &data,
-                                    int anim) {
-  activeTimeLabel = NULL; // CRITICAL: Reset pointer before transition
-  if (&data != &cachedStock)
-    cachedStock = data;
-  StockView::show(data, anim);
+uint16_t GuiController::countObjects(lv_obj_t *obj) {
+  uint16_t n = 1;
+  uint32_t cnt = lv_obj_get_child_cnt(obj);
+  for (uint32_t i = 0; i < cnt; i++)
+    n += countObjects(lv_obj_get_child(obj, i));
+  return n;
 }
 
 // --- CONTROLLER LOGIC ---
 
 void GuiController::setActiveTimeLabel(lv_obj_t *label) {
   activeTimeLabel = label;
+  lastTimeUpdate = 0; // Hidden screens' clocks are stale: update now
 }
 
 void GuiController::updateTime() {
@@ -223,8 +574,7 @@ void GuiController::updateTime() {
   // Previously checked lv_obj_is_valid, but that is unsafe on freed pointers.
   // We rely on STRICT NULL management now.
 
-  static uint32_t lastTimeUpdate = 0;
-  if (millis() - lastTimeUpdate < 1000)
+  if (lastTimeUpdate != 0 && millis() - lastTimeUpdate < 1000)
     return; // Throttle to 1s
   lastTimeUpdate = millis();
 
@@ -235,13 +585,24 @@ void GuiController::updateTime() {
     // Ideally Views should format it, but updating generic label text is fine.
     // Bus/Stock use HH:MM. Weather uses HH:MM.
     strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-    lv_label_set_text(activeTimeLabel, timeStr);
+    // Only on change: a same-text set would still invalidate the label
+    if (strcmp(lv_label_get_text(activeTimeLabel), timeStr) != 0)
+      lv_label_set_text(activeTimeLabel, timeStr);
   }
 }
 
 void GuiController::handleGesture(lv_event_t *e) {
-  lv_dir_t dir = lv_indev_get_gesture_dir(lv_indev_get_act());
+  // Software fallback: only until the controller reports its own swipes
+  if (hwGestures)
+    return;
+  lastSwGestureMs = millis();
+  navigate(lv_indev_get_gesture_dir(lv_indev_get_act()), micros());
+}
+
+void GuiController::navigate(lv_dir_t dir, uint32_t startUs) {
   // Serial.printf("DEBUG: Gesture Dir: %d, App: %d\n", dir, currentApp);
+  if (dir == LV_DIR_TOP || dir == LV_DIR_BOTTOM)
+    switchStartUs = startUs; // Traced up to the first pixel
 
   // --- CIRCULAR NAVIGATION (Up/Down) ---
   if (dir == LV_DIR_TOP) {
@@ -249,14 +610,14 @@ void GuiController::handleGesture(lv_event_t *e) {
     if (currentApp == APP_WEATHER) {
       showStockScreen(cachedStock, LV_SCR_LOAD_ANIM_MOVE_TOP);
     } else if (currentApp == APP_STOCK) {
-      showBusScreen(cachedBus, LV_SCR_LOAD_ANIM_MOVE_TOP);
+      showBusScreen(busShown(), LV_SCR_LOAD_ANIM_MOVE_TOP);
     } else if (currentApp == APP_BUS) {
       showWeatherScreen(cachedWeather, LV_SCR_LOAD_ANIM_MOVE_TOP);
     }
   } else if (dir == LV_DIR_BOTTOM) {
     // DOWN: Weather -> Bus -> Stocks -> Weather
     if (currentApp == APP_WEATHER) {
-      showBusScreen(cachedBus, LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
+      showBusScreen(busShown(), LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
     } else if (currentApp == APP_BUS) {
       showStockScreen(cachedStock, LV_SCR_LOAD_ANIM_MOVE_BOTTOM);
     } else if (currentApp == APP_STOCK) {
@@ -269,6 +630,7 @@ void GuiController::handleGesture(lv_event_t *e) {
       if (cityCount > 1) {
         currentCityIndex = (currentCityIndex + 1) % cityCount;
         cityChanged = true;
+        DataManager::notifyUiChange();
       }
     }
     // Bus Swipe Removed
@@ -277,6 +639,7 @@ void GuiController::handleGesture(lv_event_t *e) {
       if (cityCount > 1) {
         currentCityIndex = (currentCityIndex - 1 + cityCount) % cityCount;
         cityChanged = true;
+        DataManager::notifyUiChange();
       }
     }
     // Bus Swipe Removed
@@ -298,12 +661,16 @@ void GuiController::handleScreenClick(lv_event_t *e) {
 
   if (currentApp == APP_WEATHER) {
     forecastMode = (forecastMode + 1) % 3;
+    switchStartUs = micros();
     showWeatherScreen(cachedWeather, LV_SCR_LOAD_ANIM_FADE_ON);
   } else if (currentApp == APP_BUS) {
-    // Switch Station on Tap
+    // Switch Station on Tap: each stop, then the merged board
     if (busStopCount > 1) {
-      currentBusIndex = (currentBusIndex + 1) % busStopCount;
+      currentBusIndex = (currentBusIndex + 1) % (busStopCount + 1);
       busStationChanged = true;
+      DataManager::notifyUiChange();
+      if (isBusBoard())
+        showBusScreen(board.data()); // Merged here: nothing to wait for
     }
   }
 }
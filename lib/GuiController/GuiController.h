@@ -3,10 +3,27 @@
 #include <Arduino.h>
 
 #include "BusService.h"
+#include "DepartureBoard.h"
 #include "StockService.h"
+#include "TouchDrv.h"
 #include "WeatherService.h"
 #include "lvgl.h"
 #include "weather_icons.h"
+#include <freertos/queue.h>
+
+// GUI task pacing: refresh period while something is invalidated or
+// animating, and the longest sleep while the screen is static (commands and
+// data events wake the task earlier).
+#define GUI_FRAME_MS 16
+#define GUI_IDLE_MS 100
+#define GUI_TASK_CORE 1
+
+// Screen cache: the app screens (and each weather mode) stay built and are
+// updated in the background, so a swipe is only a screen load. Below
+// GUI_SCREEN_HEAP_MIN free heap hidden screens are dropped when idle and
+// rebuilt on demand; GUI_RESIDENT_SCREENS 0 always does that.
+#define GUI_RESIDENT_SCREENS 1
+#define GUI_SCREEN_HEAP_MIN 48000
 
 // Include Views
 #include "BusView.h"
@@ -15,34 +32,45 @@
 
 class GuiController {
 public:
-  static void init();
-  static void handle(uint32_t ms);
+  static void init();  // LVGL + display; call from setup() before begin()
+  static void begin(); // Start the GUI task, the only LVGL caller afterwards
+  static void wake();  // Any task: run the GUI loop now (new data events)
+  static void IRAM_ATTR wakeFromTouchISR(); // Touch INT: read input now
+  // Controller-decoded gesture; `scrolled`: the press scrolled a list
+  static void postGesture(TouchGesture g, bool scrolled);
 
   // These now delegate to Views
-  static void showWeatherScreen(const WeatherData &data, int anim = -1);
-  static void showBusScreen(const BusData &data, int anim = -1);
+  // Passing the cached copy (navigation) only loads a resident screen;
+  // new data is pushed into it first.
+  static void
+  showWeatherScreen(const WeatherData &data,
+                    lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_NONE);
+  static void showBusScreen(const BusData &data,
+                            lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_NONE);
   static void showStockScreen(const std::vector<StockItem> &data,
-                              int anim = -1);
+                              lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_NONE);
 
-  static void update(); // Main loop driver
-  static void showLoadingScreen(const char *msg = nullptr);
+  static void showLoadingScreen(const char *msg = nullptr); // Any task
   static void updateTime();                        // Efficient clock update
   static void setActiveTimeLabel(lv_obj_t *label); // New setter
-  static String sanitize(const String &text);      // Safe Return by Value
 
   static bool isBusScreenActive();
   static bool isStockScreenActive();
+  // Cache + resident screen, shown or not
+  static void updateWeatherCache(const WeatherData &data);
   static void updateBusCache(const BusData &data);
   static void updateStockCache(const std::vector<StockItem> &data);
 
   enum AppMode { APP_WEATHER, APP_STOCK, APP_BUS };
   static AppMode currentApp;
 
-  // Multi-Bus Support
+  // Multi-Bus Support. With several stops, index busStopCount is the
+  // merged departures board (the default); a tap cycles board -> stops.
   static int currentBusIndex;
   static int busStopCount;
   static bool busStationChanged;
   static int getBusIndex();
+  static bool isBusBoard();
   static void setBusStopCount(int count);
   static bool hasBusStationChanged();
   static void clearBusStationChanged();
@@ -60,15 +88,47 @@ public:
   static void handleGesture(lv_event_t *e);
   static void handleScreenClick(lv_event_t *e);
 
+  // Build stats for the view logs: objects in a tree (incl. the root)
+  static uint16_t countObjects(lv_obj_t *obj);
+
 private:
-  static String pendingMsg;
-  static bool needsUpdate;
+  // View commands from other tasks
+  enum GuiCommandType { CMD_WAKE, CMD_LOADING, CMD_TOUCH, CMD_GESTURE };
+  struct GuiCommand {
+    GuiCommandType type;
+    char msg[32];
+    uint8_t arg; // CMD_GESTURE: TouchGesture
+    uint32_t us; // CMD_GESTURE: micros() at detection
+    bool scrolled; // CMD_GESTURE: the drag scrolled a list
+  };
+  static QueueHandle_t cmdQueue;
+  static TaskHandle_t guiTaskHandle;
+
+  static void guiTask(void *parameter);
+  static void handleCommand(const GuiCommand &cmd);
+  static void navigate(lv_dir_t dir, uint32_t startUs);
+
+  // Hardware gestures replace LVGL's software detection once seen
+  static bool hwGestures;
+  static uint32_t lastSwGestureMs;
+  static void syncData(); // Drain DataManager events, redraw once each
   static void drawLoadingScreen(const char *msg);
 
+  // Screen cache
+  static void loadScreen(lv_obj_t *scr, lv_obj_t *timeLabel,
+                         lv_scr_load_anim_t anim);
+  static bool keepScreens(); // Budget check, logs on/off transitions
+  static void dropHiddenScreens();
+  static void maintainScreens(); // Idle: prebuild or drop hidden screens
+
+  // Bus screen source: the merged board or the selected stop's cache
+  static const BusData &busShown();
+  static lv_obj_t *updateBusView();
+  static void mergeBusStops(uint32_t stops); // Bit per refreshed stop
+
   // Cache data for gestures/redraws
   static WeatherData cachedWeather;
   static BusData cachedBus;
+  static DepartureBoard board; // Every stop, fed by DataManager events
   static std::vector<StockItem> cachedStock;
-
-  static SemaphoreHandle_t guiMutex; // Thread Safety for Loading Msg & State
 };
@@ -2,34 +2,82 @@
 #include "DataManager.h"
 #include "GuiController.h"
 #include "NetworkManager.h"
+#include "Theme.h"
 #include <cstdio>
 
-LV_FONT_DECLARE(lv_font_montserrat_14);
-LV_FONT_DECLARE(lv_font_montserrat_16);
-LV_FONT_DECLARE(lv_font_montserrat_14);
-LV_FONT_DECLARE(lv_font_montserrat_16);
 LV_FONT_DECLARE(lv_font_montserrat_20);
-LV_FONT_DECLARE(lv_font_montserrat_24);
 
-void StockView::show(const std::vector<StockItem> &data, int anim) {
-  GuiController::currentApp = GuiController::APP_STOCK;
+StockView::Widgets StockView::ui = {};
+VirtualList StockView::list;
+StockView::Row StockView::rows[VirtualList::MAX_POOL];
+const std::vector<StockItem> *StockView::items = NULL;
+
+void StockView::createRow(lv_obj_t *row, int slot) {
+  Row &r = rows[slot];
+  Theme::add(row, &Theme::stockRow);
+  Theme::add(row, &Theme::card);
+  Theme::add(row, &Theme::rowBg[1]);
+  Theme::add(row, &Theme::translucent);
+
+  // Symbol (Company Name) - Size 20, Left Mid
+  r.symbol = lv_label_create(row);
+  Theme::add(r.symbol, &Theme::stockSymbol);
+
+  // Right Container (Price + Change)
+  lv_obj_t *right_box = lv_obj_create(row);
+  Theme::add(right_box, &Theme::stockQuote);
+  lv_obj_clear_flag(right_box, LV_OBJ_FLAG_CLICKABLE);
+
+  // Price - Size 20
+  r.price = lv_label_create(right_box);
+  Theme::add(r.price, &Theme::stockPrice);
+
+  // Change % - Size 14
+  r.change = lv_label_create(right_box);
+  Theme::add(r.change, &Theme::stockChange);
+}
 
-  lv_obj_t *new_scr = lv_obj_create(NULL);
+void StockView::bindRow(lv_obj_t *row, int slot, int i) {
+  Row &r = rows[slot];
+  const StockItem &item = (*items)[i];
+
+  lv_label_set_text(r.symbol, item.symbol.c_str());
+
+  char buf[32];
+  if (item.price < 1.0)
+    snprintf(buf, sizeof(buf), "$%.4f", item.price);
+  else
+    snprintf(buf, sizeof(buf), "$%.2f", item.price);
+  lv_label_set_text(r.price, buf);
+
+  snprintf(buf, sizeof(buf), "%+.2f%%", item.changePercent);
+  lv_label_set_text(r.change, buf);
+  lv_color_t cColor = (item.changePercent >= 0) ? lv_color_hex(0x00FF00)
+                                                : lv_color_hex(0xFF4444);
+  lv_obj_set_style_text_color(r.change, cColor, 0);
+}
+
+void StockView::onScreenDeleted(lv_event_t *e) {
+  // Dropped by the screen cache (over its heap budget)
+  if (lv_event_get_target(e) == ui.screen)
+    memset(&ui, 0, sizeof(ui));
+}
 
+void StockView::build() {
+  uint32_t heap0 = ESP.getFreeHeap();
+  lv_obj_t *new_scr = lv_obj_create(NULL);
+  ui.screen = new_scr;
+  lv_obj_add_event_cb(new_scr, onScreenDeleted, LV_EVENT_DELETE, NULL);
   lv_obj_add_event_cb(new_scr, GuiController::handleGesture, LV_EVENT_GESTURE,
                       NULL);
   lv_obj_add_event_cb(new_scr, GuiController::handleScreenClick,
                       LV_EVENT_CLICKED, NULL);
 
-  lv_obj_set_style_bg_color(new_scr, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_bg_opa(new_scr, LV_OPA_COVER, 0);
+  Theme::add(new_scr, &Theme::screen);
 
   // Header
   lv_obj_t *header = lv_obj_create(new_scr);
-  lv_obj_set_size(header, LV_PCT(100), 40);
-  lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(header, 0, 0);
-  lv_obj_set_style_pad_all(header, 5, 0);
+  Theme::add(header, &Theme::header);
   lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_add_flag(header,
                   LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_GESTURE_BUBBLE);
@@ -41,128 +89,63 @@ void StockView::show(const std::vector<StockItem> &data, int anim) {
                              0); // Title 20px
   lv_obj_align(title, LV_ALIGN_TOP_LEFT, 0, 0);
 
-  // Time
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 10)) {
-    char timeStr[32];
-    strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-    lv_obj_t *time_lb = lv_label_create(header);
-    lv_label_set_text(time_lb, timeStr);
-    lv_obj_set_style_text_color(time_lb, lv_color_hex(0xAAAAAA), 0);
-    lv_obj_set_style_text_font(time_lb, &lv_font_montserrat_20,
-                               0); // Upgrade 14->20
-    lv_obj_align(time_lb, LV_ALIGN_TOP_RIGHT, 0, 0);
-    GuiController::setActiveTimeLabel(time_lb);
-
-    // Status Dot
-    lv_obj_t *dot = lv_obj_create(header);
-    lv_obj_set_size(dot, 10, 8); // Wider
-    lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(dot, 0, 0);
-    lv_obj_align_to(dot, time_lb, LV_ALIGN_OUT_LEFT_MID, -7, 0); // Right 1px
-    lv_obj_clear_flag(dot, LV_OBJ_FLAG_SCROLLABLE);
-
-    uint32_t dotColor = 0x00AA00; // Dark Green
-    uint32_t lastUpdate = DataManager::getStockLastUpdate();
-    if (DataManager::isStockUpdating()) {
-      dotColor = 0xFFFF00; // Yellow
-    } else if (lastUpdate == 0 ||
-               (millis() - lastUpdate > 300000)) { // 5m Stale
-      dotColor = 0xFF0000;                         // Red
-    }
-    lv_obj_set_style_bg_color(dot, lv_color_hex(dotColor), 0);
-  }
+  // Time (updateTime() fills it in while the screen is active)
+  ui.time = lv_label_create(header);
+  lv_label_set_text(ui.time, "--:--");
+  Theme::add(ui.time, &Theme::clock);
+
+  // Status Dot
+  ui.dot = lv_obj_create(header);
+  Theme::add(ui.dot, &Theme::dot);
+  lv_obj_align_to(ui.dot, ui.time, LV_ALIGN_OUT_LEFT_MID, -7, 0); // Right 1px
+  lv_obj_clear_flag(ui.dot, LV_OBJ_FLAG_SCROLLABLE);
 
   // List
-  lv_obj_t *list = lv_obj_create(new_scr);
-  lv_obj_set_size(list, LV_PCT(100), 280);
-  lv_obj_align(list, LV_ALIGN_TOP_MID, 0, 30);
-  lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-  lv_obj_set_style_bg_opa(list, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(list, 0, 0);
-  lv_obj_set_style_pad_all(list, 0, 0); // Fix: Remove default padding
-  lv_obj_add_flag(list, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_GESTURE_BUBBLE);
+  lv_obj_t *cont = list.create(new_scr, 280, 70, createRow, bindRow);
+  Theme::add(cont, &Theme::bare);
+  lv_obj_align(cont, LV_ALIGN_TOP_MID, 0, 30);
+  lv_obj_add_flag(cont, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_GESTURE_BUBBLE);
+
+  ui.empty = lv_label_create(cont);
+  lv_obj_set_style_text_color(ui.empty, lv_color_hex(0x888888), 0);
+  lv_obj_set_style_text_align(ui.empty, LV_TEXT_ALIGN_CENTER, 0);
+  lv_obj_align(ui.empty, LV_ALIGN_CENTER, 0, 0);
+
+  Serial.printf("GUI: Stock built: %u objects, %u B heap\n",
+                GuiController::countObjects(new_scr),
+                (unsigned)(heap0 - ESP.getFreeHeap()));
+}
+
+lv_obj_t *StockView::update(const std::vector<StockItem> &data) {
+  if (!ui.screen)
+    build();
+  items = &data;
 
   if (data.empty()) {
-    lv_obj_t *lbl = lv_label_create(list);
-
-    String msg = "Loading...";
-    if (NetworkManager::getStockSymbols().length() == 0) {
-      msg = "No Symbols Configured";
-    } else {
-      msg = "No Data Received.\nCheck Network";
-    }
-
-    lv_label_set_text(lbl, msg.c_str());
-    lv_obj_set_style_text_color(lbl, lv_color_hex(0x888888), 0);
-    lv_obj_set_style_text_align(lbl, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(lbl, LV_ALIGN_CENTER, 0, 0);
+    if (NetworkManager::getStockSymbols().length() == 0)
+      lv_label_set_text(ui.empty, "No Symbols Configured");
+    else
+      lv_label_set_text(ui.empty, "No Data Received.\nCheck Network");
+    lv_obj_clear_flag(ui.empty, LV_OBJ_FLAG_HIDDEN);
   } else {
-    for (const auto &item : data) {
-      lv_obj_t *row = lv_obj_create(list);
-      lv_obj_set_size(row, LV_PCT(100), 70); // 70px Height
-      lv_obj_set_style_bg_color(row, lv_color_hex(0x202020), 0);
-      lv_obj_set_style_bg_opa(row, LV_OPA_80, 0);
-      lv_obj_set_style_border_color(row, lv_color_hex(0x777777), 0);
-      lv_obj_set_style_border_width(row, 2, 0);
-      lv_obj_set_style_border_opa(row, LV_OPA_70, 0);
-      lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
-      lv_obj_add_flag(row,
-                      LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_GESTURE_BUBBLE);
-
-      // Symbol (Company Name) - Size 20, Left Mid
-      lv_obj_t *sym = lv_label_create(row);
-      lv_label_set_text(sym, item.symbol.c_str());
-      lv_obj_set_style_text_color(sym, lv_color_hex(0xFFFFFF), 0);
-      lv_obj_set_style_text_font(sym, &lv_font_montserrat_20,
-                                 0); // 20px
-      lv_obj_align(sym, LV_ALIGN_LEFT_MID, 5, 0);
-
-      // Right Container (Price + Change)
-      lv_obj_t *right_box = lv_obj_create(row);
-      lv_obj_set_size(right_box, LV_SIZE_CONTENT, LV_PCT(100)); // Auto width
-      lv_obj_align(right_box, LV_ALIGN_RIGHT_MID, -10,
-                   0); // Added margin from right edge
-      lv_obj_set_flex_flow(right_box, LV_FLEX_FLOW_COLUMN);
-      lv_obj_set_flex_align(right_box, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_END,
-                            LV_FLEX_ALIGN_CENTER);
-      lv_obj_set_style_bg_opa(right_box, LV_OPA_TRANSP, 0);
-      lv_obj_set_style_border_width(right_box, 0, 0);
-      lv_obj_set_style_pad_all(right_box, 0, 0);
-      lv_obj_set_style_pad_row(right_box, 0, 0); // Remove gap to save space
-      lv_obj_clear_flag(right_box, LV_OBJ_FLAG_CLICKABLE);
-
-      // Price - Size 20
-      lv_obj_t *price = lv_label_create(right_box);
-      char buf[32];
-      if (item.price < 1.0)
-        snprintf(buf, sizeof(buf), "$%.4f", item.price);
-      else
-        snprintf(buf, sizeof(buf), "$%.2f", item.price);
-      lv_label_set_text(price, buf);
-      lv_obj_set_style_text_color(price, lv_color_hex(0xFFFFFF), 0);
-      lv_obj_set_style_text_font(price, &lv_font_montserrat_20,
-                                 0); // 20px
-      lv_obj_set_style_text_align(price, LV_TEXT_ALIGN_RIGHT, 0);
-
-      // Change % - Size 16
-      lv_obj_t *change = lv_label_create(right_box);
-      snprintf(buf, sizeof(buf), "%+.2f%%", item.changePercent);
-      lv_label_set_text(change, buf);
-      lv_color_t cColor = (item.changePercent >= 0) ? lv_color_hex(0x00FF00)
-                                                    : lv_color_hex(0xFF4444);
-      lv_obj_set_style_text_color(change, cColor, 0);
-      lv_obj_set_style_text_font(change, &lv_font_montserrat_14,
-                                 0); // 14px
-      lv_obj_set_style_text_align(change, LV_TEXT_ALIGN_RIGHT, 0);
-    }
+    lv_obj_add_flag(ui.empty, LV_OBJ_FLAG_HIDDEN);
   }
+  list.setCount(data.size());
 
-  lv_scr_load_anim_t anim_type = LV_SCR_LOAD_ANIM_NONE;
-  if (anim == 2)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_BOTTOM;
-  else if (anim == -2)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_TOP;
+  refreshStatus();
+  return ui.screen;
+}
 
-  lv_scr_load_anim(new_scr, anim_type, (anim == 0) ? 0 : 300, 0, true);
+void StockView::refreshStatus() {
+  if (!ui.screen)
+    return;
+  uint32_t dotColor = 0x00AA00; // Dark Green
+  uint32_t lastUpdate = DataManager::getStockLastUpdate();
+  if (DataManager::isStockUpdating()) {
+    dotColor = 0xFFFF00; // Yellow
+  } else if (lastUpdate == 0 ||
+             (millis() - lastUpdate > 300000)) { // 5m Stale
+    dotColor = 0xFF0000;                         // Red
+  }
+  lv_obj_set_style_bg_color(ui.dot, lv_color_hex(dotColor), 0);
 }
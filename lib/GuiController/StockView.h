@@ -1,12 +1,43 @@
 #pragma once
 
 #include "StockService.h"
+#include "VirtualList.h"
 #include "lvgl.h"
 #include <Arduino.h>
 #include <vector>
 
 
+// Built once and kept, like BusView; update() refreshes it in place.
 class StockView {
 public:
-  static void show(const std::vector<StockItem> &data, int anim);
+  // Builds the screen if needed and returns it (not loaded); rows keep
+  // referring to `data` (see VirtualList::BindRowCb)
+  static lv_obj_t *update(const std::vector<StockItem> &data);
+  static void refreshStatus(); // Status dot only
+
+  static lv_obj_t *screen() { return ui.screen; } // NULL until built
+  static lv_obj_t *timeLabel() { return ui.time; }
+
+private:
+  // Handles, valid while screen != NULL
+  struct Widgets {
+    lv_obj_t *screen;
+    lv_obj_t *time;
+    lv_obj_t *dot;
+    lv_obj_t *empty; // No symbols / no data
+  };
+  struct Row {
+    lv_obj_t *symbol;
+    lv_obj_t *price;
+    lv_obj_t *change;
+  };
+  static Widgets ui;
+  static VirtualList list;
+  static Row rows[VirtualList::MAX_POOL]; // Per pool slot
+  static const std::vector<StockItem> *items;
+
+  static void build();
+  static void onScreenDeleted(lv_event_t *e);
+  static void createRow(lv_obj_t *row, int slot);
+  static void bindRow(lv_obj_t *row, int slot, int i);
 };
@@ -0,0 +1,231 @@
+#include "Theme.h"
+
+LV_FONT_DECLARE(lv_font_montserrat_14);
+LV_FONT_DECLARE(lv_font_montserrat_16);
+LV_FONT_DECLARE(lv_font_montserrat_20);
+#ifdef NAME_FONTS
+LV_FONT_DECLARE(font_names_14); // Montserrat subsets with accented glyphs
+LV_FONT_DECLARE(font_names_20);
+#define NAME_FONT_14 font_names_14
+#define NAME_FONT_20 font_names_20
+#else
+// Built-in Montserrat is ASCII only: Translit::forDisplay() folds names
+#define NAME_FONT_14 lv_font_montserrat_14
+#define NAME_FONT_20 lv_font_montserrat_20
+#endif
+
+lv_style_t Theme::screen;
+lv_style_t Theme::bare;
+lv_style_t Theme::header;
+lv_style_t Theme::card;
+lv_style_t Theme::translucent;
+lv_style_t Theme::rowBg[2];
+lv_style_t Theme::dot;
+lv_style_t Theme::title;
+lv_style_t Theme::clock;
+lv_style_t Theme::forecastRow;
+lv_style_t Theme::forecastTime;
+lv_style_t Theme::iconBox;
+lv_style_t Theme::icon;
+lv_style_t Theme::forecastRain;
+lv_style_t Theme::forecastTrend;
+lv_style_t Theme::textWhite;
+lv_style_t Theme::pill;
+lv_style_t Theme::pillValue;
+lv_style_t Theme::pillLabel;
+lv_style_t Theme::busRow;
+lv_style_t Theme::busBadge;
+lv_style_t Theme::busBadgeText;
+lv_style_t Theme::busText;
+lv_style_t Theme::busDest;
+lv_style_t Theme::busStop;
+lv_style_t Theme::busEta;
+lv_style_t Theme::stockRow;
+lv_style_t Theme::stockSymbol;
+lv_style_t Theme::stockQuote;
+lv_style_t Theme::stockPrice;
+lv_style_t Theme::stockChange;
+
+// Flex container: flow plus main/cross/track placement
+static void setFlex(lv_style_t *s, lv_flex_flow_t flow, lv_flex_align_t main,
+                    lv_flex_align_t cross, lv_flex_align_t track) {
+  lv_style_set_layout(s, LV_LAYOUT_FLEX);
+  lv_style_set_flex_flow(s, flow);
+  lv_style_set_flex_main_place(s, main);
+  lv_style_set_flex_cross_place(s, cross);
+  lv_style_set_flex_track_place(s, track);
+}
+
+static void setText(lv_style_t *s, uint32_t color, const lv_font_t *font) {
+  lv_style_set_text_color(s, lv_color_hex(color));
+  lv_style_set_text_font(s, font);
+}
+
+void Theme::init() {
+  // --- Containers ---
+  lv_style_init(&screen);
+  lv_style_set_bg_color(&screen, lv_color_hex(0x000000));
+  lv_style_set_bg_opa(&screen, LV_OPA_COVER);
+
+  lv_style_init(&bare);
+  lv_style_set_bg_opa(&bare, LV_OPA_TRANSP);
+  lv_style_set_border_width(&bare, 0);
+  lv_style_set_pad_all(&bare, 0);
+
+  lv_style_init(&header);
+  lv_style_set_width(&header, LV_PCT(100));
+  lv_style_set_height(&header, 40);
+  lv_style_set_bg_opa(&header, LV_OPA_TRANSP);
+  lv_style_set_border_width(&header, 0);
+  lv_style_set_pad_all(&header, 5);
+
+  lv_style_init(&card);
+  lv_style_set_border_width(&card, 2);
+  lv_style_set_border_color(&card, lv_color_hex(0x777777));
+  lv_style_set_border_opa(&card, LV_OPA_70);
+
+  lv_style_init(&translucent);
+  lv_style_set_bg_opa(&translucent, LV_OPA_80);
+
+  lv_style_init(&rowBg[0]);
+  lv_style_set_bg_color(&rowBg[0], lv_color_hex(0x101010));
+  lv_style_init(&rowBg[1]);
+  lv_style_set_bg_color(&rowBg[1], lv_color_hex(0x202020));
+
+  lv_style_init(&dot);
+  lv_style_set_width(&dot, 10);
+  lv_style_set_height(&dot, 8);
+  lv_style_set_radius(&dot, LV_RADIUS_CIRCLE);
+  lv_style_set_border_width(&dot, 0);
+
+  // --- Header text ---
+  lv_style_init(&title);
+  setText(&title, 0x00FFFF, &NAME_FONT_20); // Cyan
+  lv_style_set_width(&title, 160);
+  lv_style_set_align(&title, LV_ALIGN_TOP_LEFT);
+
+  lv_style_init(&clock);
+  setText(&clock, 0xAAAAAA, &lv_font_montserrat_20); // Grey
+  lv_style_set_align(&clock, LV_ALIGN_TOP_RIGHT);
+
+  // --- Weather ---
+  lv_style_init(&forecastRow);
+  lv_style_set_width(&forecastRow, LV_PCT(100));
+  lv_style_set_height(&forecastRow, 45);
+  setFlex(&forecastRow, LV_FLEX_FLOW_ROW, LV_FLEX_ALIGN_SPACE_BETWEEN,
+          LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+  lv_style_init(&forecastTime);
+  lv_style_set_width(&forecastTime, 60);
+  lv_style_set_text_color(&forecastTime, lv_color_hex(0xFFFFFF));
+
+  lv_style_init(&iconBox);
+  lv_style_set_width(&iconBox, 40);
+  lv_style_set_height(&iconBox, 40);
+
+  lv_style_init(&icon);
+  lv_style_set_align(&icon, LV_ALIGN_CENTER);
+  lv_style_set_img_recolor_opa(&icon, LV_OPA_COVER);
+
+  lv_style_init(&forecastRain);
+  lv_style_set_width(&forecastRain, 40);
+  lv_style_set_text_align(&forecastRain, LV_TEXT_ALIGN_CENTER);
+  setText(&forecastRain, 0x00BFFF, &lv_font_montserrat_14); // Blue
+
+  lv_style_init(&forecastTrend);
+  lv_style_set_width(&forecastTrend, 20);
+  lv_style_set_text_align(&forecastTrend, LV_TEXT_ALIGN_CENTER);
+
+  lv_style_init(&textWhite);
+  lv_style_set_text_color(&textWhite, lv_color_hex(0xFFFFFF));
+
+  lv_style_init(&pill);
+  lv_style_set_width(&pill, 105);
+  lv_style_set_height(&pill, 40);
+  lv_style_set_bg_color(&pill, lv_color_hex(0x202020));
+  lv_style_set_bg_opa(&pill, LV_OPA_80);
+  lv_style_set_radius(&pill, 10);
+  setFlex(&pill, LV_FLEX_FLOW_COLUMN, LV_FLEX_ALIGN_CENTER,
+          LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_pad_all(&pill, 0);
+  lv_style_set_pad_row(&pill, 0);
+
+  lv_style_init(&pillValue);
+  lv_style_set_text_font(&pillValue, &lv_font_montserrat_16);
+
+  lv_style_init(&pillLabel);
+  setText(&pillLabel, 0xDDDDDD, &lv_font_montserrat_16);
+
+  // --- Bus ---
+  lv_style_init(&busRow);
+  lv_style_set_width(&busRow, LV_PCT(100));
+  lv_style_set_height(&busRow, 44);
+  setFlex(&busRow, LV_FLEX_FLOW_ROW, LV_FLEX_ALIGN_START,
+          LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_pad_all(&busRow, 5);
+  lv_style_set_pad_ver(&busRow, 3); // Room for the board's two text lines
+  lv_style_set_pad_column(&busRow, 8);
+
+  lv_style_init(&busBadge);
+  lv_style_set_width(&busBadge, 40);
+  lv_style_set_height(&busBadge, 28);
+  lv_style_set_radius(&busBadge, 4);
+  lv_style_set_border_width(&busBadge, 0);
+
+  lv_style_init(&busBadgeText);
+  setText(&busBadgeText, 0xFFFFFF, &lv_font_montserrat_14);
+  lv_style_set_align(&busBadgeText, LV_ALIGN_CENTER);
+
+  lv_style_init(&busText);
+  lv_style_set_flex_grow(&busText, 1);
+  lv_style_set_height(&busText, LV_PCT(100));
+  setFlex(&busText, LV_FLEX_FLOW_COLUMN, LV_FLEX_ALIGN_CENTER,
+          LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_bg_opa(&busText, LV_OPA_TRANSP);
+  lv_style_set_border_width(&busText, 0);
+  lv_style_set_pad_all(&busText, 0);
+  lv_style_set_pad_row(&busText, 0);
+
+  lv_style_init(&busDest);
+  setText(&busDest, 0xDDDDDD, &NAME_FONT_14);
+  lv_style_set_width(&busDest, LV_PCT(100));
+
+  lv_style_init(&busStop);
+  setText(&busStop, 0x888888, &NAME_FONT_14);
+  lv_style_set_width(&busStop, LV_PCT(100));
+
+  lv_style_init(&busEta);
+  lv_style_set_width(&busEta, 55);
+  lv_style_set_text_align(&busEta, LV_TEXT_ALIGN_RIGHT);
+  lv_style_set_text_font(&busEta, &lv_font_montserrat_14);
+
+  // --- Stocks ---
+  lv_style_init(&stockRow);
+  lv_style_set_width(&stockRow, LV_PCT(100));
+  lv_style_set_height(&stockRow, 70);
+
+  lv_style_init(&stockSymbol);
+  setText(&stockSymbol, 0xFFFFFF, &lv_font_montserrat_20);
+  lv_style_set_align(&stockSymbol, LV_ALIGN_LEFT_MID);
+  lv_style_set_x(&stockSymbol, 5);
+
+  lv_style_init(&stockQuote); // Price over change %, right edge
+  lv_style_set_width(&stockQuote, LV_SIZE_CONTENT);
+  lv_style_set_height(&stockQuote, LV_PCT(100));
+  lv_style_set_align(&stockQuote, LV_ALIGN_RIGHT_MID);
+  lv_style_set_x(&stockQuote, -10);
+  setFlex(&stockQuote, LV_FLEX_FLOW_COLUMN, LV_FLEX_ALIGN_CENTER,
+          LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_CENTER);
+  lv_style_set_bg_opa(&stockQuote, LV_OPA_TRANSP);
+  lv_style_set_border_width(&stockQuote, 0);
+  lv_style_set_pad_all(&stockQuote, 0);
+  lv_style_set_pad_row(&stockQuote, 0);
+
+  lv_style_init(&stockPrice);
+  setText(&stockPrice, 0xFFFFFF, &lv_font_montserrat_20);
+  lv_style_set_text_align(&stockPrice, LV_TEXT_ALIGN_RIGHT);
+
+  lv_style_init(&stockChange);
+  lv_style_set_text_font(&stockChange, &lv_font_montserrat_14);
+  lv_style_set_text_align(&stockChange, LV_TEXT_ALIGN_RIGHT);
+}
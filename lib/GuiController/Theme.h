@@ -0,0 +1,60 @@
+#pragma once
+
+#include "lvgl.h"
+
+// Shared styles for every view, built once by GuiController::init().
+// Widgets attach them with lv_obj_add_style() instead of setting local
+// style properties, so the up to 24 forecast rows and every bus/stock row
+// share one style list (no per-object style allocation, and LVGL resolves
+// each property from a single shared table). Only data-dependent values
+// (ETA, change %, line badge, status dot colors) stay local.
+class Theme {
+public:
+  static void init(); // After lv_init(), before the first view
+
+  // Shorthand: lv_obj_add_style(obj, &style, 0)
+  static void add(lv_obj_t *obj, lv_style_t *style) {
+    lv_obj_add_style(obj, style, 0);
+  }
+
+  // --- Containers ---
+  static lv_style_t screen;      // Opaque black background
+  static lv_style_t bare;        // No background, border or padding
+  static lv_style_t header;      // 40 px header bar, 5 px padding
+  static lv_style_t card;        // 2 px grey border at 70%
+  static lv_style_t translucent; // 80% background opacity
+  static lv_style_t rowBg[2];    // Alternating row fill (even, odd)
+  static lv_style_t dot;         // Status dot (color set per state)
+
+  // --- Header text ---
+  static lv_style_t title; // City / stop name, accented font
+  static lv_style_t clock; // HH:MM, top right
+
+  // --- Weather ---
+  static lv_style_t forecastRow;
+  static lv_style_t forecastTime;
+  static lv_style_t iconBox;
+  static lv_style_t icon; // Recolored (color set per weather code)
+  static lv_style_t forecastRain;
+  static lv_style_t forecastTrend;
+  static lv_style_t textWhite;
+  static lv_style_t pill;
+  static lv_style_t pillValue; // Color set per pill
+  static lv_style_t pillLabel;
+
+  // --- Bus ---
+  static lv_style_t busRow;
+  static lv_style_t busBadge; // Line color set per line
+  static lv_style_t busBadgeText;
+  static lv_style_t busText; // Destination + stop tag column
+  static lv_style_t busDest;
+  static lv_style_t busStop; // Board stop tag
+  static lv_style_t busEta; // Color set per ETA
+
+  // --- Stocks ---
+  static lv_style_t stockRow;
+  static lv_style_t stockSymbol;
+  static lv_style_t stockQuote;
+  static lv_style_t stockPrice;
+  static lv_style_t stockChange; // Color set per sign
+};
@@ -0,0 +1,108 @@
+#include "VirtualList.h"
+
+lv_obj_t *VirtualList::create(lv_obj_t *parent, lv_coord_t height,
+                              lv_coord_t rowHeight, CreateRowCb createRow,
+                              BindRowCb bindRow) {
+  cont = lv_obj_create(parent);
+  lv_obj_set_size(cont, LV_PCT(100), height);
+  lv_obj_set_scroll_dir(cont, LV_DIR_VER);
+  lv_obj_add_event_cb(cont, onScroll, LV_EVENT_SCROLL, this);
+  lv_obj_add_event_cb(cont, onDelete, LV_EVENT_DELETE, this);
+
+  // Invisible child spanning every item so LVGL scrolls the full length
+  spacer = lv_obj_create(cont);
+  lv_obj_remove_style_all(spacer);
+  lv_obj_set_size(spacer, 1, 0);
+  lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_add_flag(spacer, LV_OBJ_FLAG_EVENT_BUBBLE);
+
+  this->rowHeight = rowHeight;
+  this->createRow = createRow;
+  this->bindRow = bindRow;
+  count = 0;
+
+  // Rows in view (+1 partial) plus the margins, rounded up to even
+  pool = (height + rowHeight - 1) / rowHeight + 1 + 2 * MARGIN;
+  pool = (pool + 1) & ~1;
+  if (pool > MAX_POOL)
+    pool = MAX_POOL;
+  for (int i = 0; i < MAX_POOL; i++) {
+    rows[i] = NULL;
+    bound[i] = -1;
+  }
+  return cont;
+}
+
+void VirtualList::setCount(int n) {
+  if (!cont)
+    return;
+  count = n;
+  lv_coord_t pitch = rowHeight + lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+  lv_obj_set_height(spacer, n > 0 ? n * pitch - (pitch - rowHeight) : 0);
+  update(true);
+}
+
+void VirtualList::refresh() {
+  if (cont)
+    update(true);
+}
+
+int VirtualList::liveRows() const {
+  int n = 0;
+  for (int i = 0; i < pool; i++)
+    if (rows[i])
+      n++;
+  return n;
+}
+
+void VirtualList::update(bool rebind) {
+  lv_coord_t pitch = rowHeight + lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
+  int first = lv_obj_get_scroll_y(cont) / pitch - MARGIN;
+  if (first > count - pool)
+    first = count - pool;
+  if (first < 0)
+    first = 0;
+
+  for (int i = first; i < first + pool; i++) {
+    int slot = i % pool;
+    lv_obj_t *row = rows[slot];
+    if (i >= count) {
+      if (row && bound[slot] != -1)
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+      bound[slot] = -1;
+      continue;
+    }
+
+    if (!row) {
+      row = rows[slot] = lv_obj_create(cont);
+      lv_obj_add_flag(row, LV_OBJ_FLAG_EVENT_BUBBLE |
+                               LV_OBJ_FLAG_GESTURE_BUBBLE);
+      lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+      createRow(row, slot);
+    }
+    if (bound[slot] != i) {
+      if (bound[slot] == -1)
+        lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+      lv_obj_set_y(row, i * pitch);
+      bound[slot] = i;
+      bindRow(row, slot, i);
+    } else if (rebind) {
+      bindRow(row, slot, i);
+    }
+  }
+}
+
+void VirtualList::onScroll(lv_event_t *e) {
+  VirtualList *list = (VirtualList *)lv_event_get_user_data(e);
+  list->update(false);
+}
+
+void VirtualList::onDelete(lv_event_t *e) {
+  // Screen deleted: the rows went with it
+  VirtualList *list = (VirtualList *)lv_event_get_user_data(e);
+  if (lv_event_get_target(e) == list->cont) {
+    list->cont = NULL;
+    list->spacer = NULL;
+    list->pool = 0;
+  }
+}
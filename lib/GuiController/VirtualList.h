@@ -0,0 +1,49 @@
+#pragma once
+
+#include "lvgl.h"
+
+// Scrollable column of `count` fixed-height rows backed by a fixed pool of
+// row objects: only the rows in view plus MARGIN above and below exist.
+// While scrolling, a row leaving the window is moved to the item entering
+// it and rebound, so any item count costs the same objects.
+//
+// Item i always lives in pool slot i % pool. The pool size is even, so a
+// slot keeps the parity of its items (stripes can be styled once in
+// createRow). Row height comes from the view's row style and must match
+// `rowHeight`; rows are spaced by the container's pad_row.
+class VirtualList {
+public:
+  typedef void (*CreateRowCb)(lv_obj_t *row, int slot); // Children, once
+  // Runs again whenever a row scrolls into view, so the data it reads must
+  // outlive the list: views bind to GuiController's cached copy.
+  typedef void (*BindRowCb)(lv_obj_t *row, int slot, int index);
+
+  static const int MARGIN = 2;    // Spare rows on each side of the view
+  static const int MAX_POOL = 16; // Object budget cap
+
+  // Full-width container `height` px tall; rows are created on demand
+  lv_obj_t *create(lv_obj_t *parent, lv_coord_t height, lv_coord_t rowHeight,
+                   CreateRowCb createRow, BindRowCb bindRow);
+
+  void setCount(int count); // Item count changed: resize and rebind
+  void refresh();           // Item data changed: rebind the live rows
+
+  bool isValid() const { return cont != NULL; } // False once deleted
+  lv_obj_t *obj() const { return cont; }
+  int liveRows() const; // Row objects created so far
+
+private:
+  lv_obj_t *cont = NULL;
+  lv_obj_t *spacer = NULL; // Sets the scroll height to count rows
+  lv_obj_t *rows[MAX_POOL];
+  int16_t bound[MAX_POOL]; // Item index per slot, -1 = free
+  int pool = 0;
+  int count = 0;
+  lv_coord_t rowHeight = 0;
+  CreateRowCb createRow = NULL;
+  BindRowCb bindRow = NULL;
+
+  void update(bool rebind);
+  static void onScroll(lv_event_t *e);
+  static void onDelete(lv_event_t *e);
+};
@@ -1,29 +1,31 @@
 #include "WeatherView.h"
 #include "DataManager.h"
 #include "GuiController.h"
+#include "Theme.h"
 #include <cstdio>
 
-LV_FONT_DECLARE(lv_font_montserrat_14);
 LV_FONT_DECLARE(lv_font_montserrat_16);
-LV_FONT_DECLARE(lv_font_montserrat_24);
 
 // Helper for Month Names
 static const char *months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
                                "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 
-void WeatherView::formatDate(const char *input, char *output) {
-  int y, m, d;
-  if (sscanf(input, "%d-%d-%d", &y, &m, &d) == 3) {
-    if (m >= 1 && m <= 12) {
-      sprintf(output, "%d %s", d, months[m - 1]); // Format: "DD Month"
-    } else {
-      strcpy(output, input); // Fallback
-    }
+void WeatherView::formatDate(uint32_t date, char *output) {
+  int m = dailyMonth(date);
+  if (m >= 1 && m <= 12) {
+    sprintf(output, "%d %s", dailyDay(date), months[m - 1]); // "DD Month"
   } else {
-    strcpy(output, input);
+    strcpy(output, "Day"); // Fallback
   }
 }
 
+void WeatherView::formatTime(uint32_t epoch, char *output) {
+  time_t t = epoch;
+  struct tm tm;
+  localtime_r(&t, &tm);
+  sprintf(output, "%02d:%02d", tm.tm_hour, tm.tm_min); // "HH:MM"
+}
+
 const char *WeatherView::getWeatherDesc(int code) {
   switch (code) {
   case 0:
@@ -62,97 +64,149 @@ const char *WeatherView::getWeatherDesc(int code) {
   }
 }
 
-void WeatherView::createWeatherIcon(lv_obj_t *parent, int code, bool isNight) {
-  lv_obj_clean(parent);
-  const void *src = &weather_icon_cloud;
-  lv_color_t color = lv_color_hex(0xFFFFFF);
+WeatherView::Widgets WeatherView::modes[WeatherView::MODE_COUNT] = {};
+VirtualList WeatherView::lists[WeatherView::MODE_COUNT];
+const WeatherData *WeatherView::shown = NULL;
+uint16_t WeatherView::changes = 0;
+
+void WeatherView::iconFor(int code, bool isNight, const void **src,
+                          uint32_t *color) {
+  *src = &weather_icon_cloud;
+  *color = 0xFFFFFF;
 
   if (code == 0) {
     if (isNight) {
-      src = &weather_icon_moon;
-      color = lv_color_hex(0xEEEEEE); // Moon color
+      *src = &weather_icon_moon;
+      *color = 0xEEEEEE; // Moon color
     } else {
-      src = &weather_icon_sun;
-      color = lv_color_hex(0xFFD700);
+      *src = &weather_icon_sun;
+      *color = 0xFFD700;
     }
   } else if (code == 1 || code == 2) {
     if (isNight) {
-      src = &weather_icon_night_part_cloud;
-      color = lv_color_hex(0xDDDDDD); // Night cloud
+      *src = &weather_icon_night_part_cloud;
+      *color = 0xDDDDDD; // Night cloud
     } else {
-      src = &weather_icon_part_cloud;
-      color = lv_color_hex(0xFFEEAA);
+      *src = &weather_icon_part_cloud;
+      *color = 0xFFEEAA;
     }
   } else if (code == 3) {
-    src = &weather_icon_cloud;
-    color = lv_color_hex(0xEEEEEE);
+    *src = &weather_icon_cloud;
+    *color = 0xEEEEEE;
   } else if (code == 45 || code == 48) {
-    src = &weather_icon_fog;
-    color = lv_color_hex(0xAAAAAA);
+    *src = &weather_icon_fog;
+    *color = 0xAAAAAA;
   } else if (code >= 51 && code <= 55) {
-    src = &weather_icon_drizzle;
-    color = lv_color_hex(0xADD8E6);
+    *src = &weather_icon_drizzle;
+    *color = 0xADD8E6;
   } else if (code >= 61 && code <= 67) {
-    src = &weather_icon_rain;
-    color = lv_color_hex(0x00BFFF);
+    *src = &weather_icon_rain;
+    *color = 0x00BFFF;
   } else if (code >= 71 && code <= 77) {
-    src = &weather_icon_snow;
-    color = lv_color_hex(0xE0FFFF);
+    *src = &weather_icon_snow;
+    *color = 0xE0FFFF;
   } else if (code >= 80 && code <= 82) {
-    src = &weather_icon_showers;
-    color = lv_color_hex(0x1E90FF);
+    *src = &weather_icon_showers;
+    *color = 0x1E90FF;
   } else if (code >= 85 && code <= 86) {
-    src = &weather_icon_snow;
-    color = lv_color_hex(0xE0FFFF);
+    *src = &weather_icon_snow;
+    *color = 0xE0FFFF;
   } else if (code >= 95) {
-    src = &weather_icon_thunder;
-    color = lv_color_hex(0x9370DB);
+    *src = &weather_icon_thunder;
+    *color = 0x9370DB;
+  }
+}
+
+// --- DIFF SETTERS ---
+// Each one compares against what the widget already shows, so unchanged
+// fields never invalidate (and never redraw) their area.
+
+void WeatherView::setText(lv_obj_t *label, const char *text) {
+  if (strcmp(lv_label_get_text(label), text) != 0) {
+    lv_label_set_text(label, text);
+    changes++;
+  }
+}
+
+void WeatherView::setTextColor(lv_obj_t *obj, uint32_t color) {
+  lv_color_t c = lv_color_hex(color);
+  if (lv_obj_get_style_text_color(obj, 0).full != c.full) {
+    lv_obj_set_style_text_color(obj, c, 0);
+    changes++;
+  }
+}
+
+void WeatherView::setBgColor(lv_obj_t *obj, uint32_t color) {
+  lv_color_t c = lv_color_hex(color);
+  if (lv_obj_get_style_bg_color(obj, 0).full != c.full) {
+    lv_obj_set_style_bg_color(obj, c, 0);
+    changes++;
+  }
+}
+
+void WeatherView::setVisible(lv_obj_t *obj, bool visible) {
+  if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == visible) {
+    if (visible)
+      lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else
+      lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    changes++;
   }
+}
 
-  lv_obj_t *img = lv_img_create(parent);
-  lv_img_set_src(img, src);
-  lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
-  lv_obj_set_style_img_recolor_opa(img, LV_OPA_COVER, 0);
-  lv_obj_set_style_img_recolor(img, color, 0);
+void WeatherView::setIcon(lv_obj_t *img, int code, bool isNight) {
+  const void *src;
+  uint32_t color;
+  iconFor(code, isNight, &src, &color);
+  if (lv_img_get_src(img) != src) {
+    lv_img_set_src(img, src);
+    changes++;
+  }
+  lv_color_t c = lv_color_hex(color);
+  if (lv_obj_get_style_img_recolor(img, 0).full != c.full) {
+    lv_obj_set_style_img_recolor(img, c, 0);
+    changes++;
+  }
 }
 
-void WeatherView::show(const WeatherData &data, int anim, int forecastMode) {
-  GuiController::currentApp = GuiController::APP_WEATHER;
+void WeatherView::onRootDeleted(lv_event_t *e) {
+  // Screen dropped by the screen cache (over its heap budget) or cleaned:
+  // drop that mode's handles.
+  for (int m = 0; m < MODE_COUNT; m++)
+    if (lv_event_get_target(e) == modes[m].root)
+      memset(&modes[m], 0, sizeof(Widgets));
+}
 
-  // Note: We create a NEW screen, so auto_del of the previous one is handled by
-  // LVGL if anim is used correctly or we rely on the caller to manage
-  // transitions. GuiController logic used lv_scr_load_anim(..., auto_del=true).
+WeatherView::Widgets &WeatherView::owner(lv_obj_t *row) {
+  return modes[lv_obj_get_parent(row) == lists[2].obj() ? 2 : 1];
+}
+
+// --- BUILD (once per mode) ---
+
+void WeatherView::build(int forecastMode) {
+  Widgets &w = modes[forecastMode];
+  memset(&w, 0, sizeof(w));
+  w.mode = forecastMode;
 
   lv_obj_t *new_scr = lv_obj_create(NULL);
   lv_obj_clear_flag(new_scr, LV_OBJ_FLAG_SCROLLABLE);
-
-  char buf[128];
+  w.screen = new_scr;
 
   // Base Background
-  lv_obj_set_style_bg_color(new_scr, lv_color_hex(0x000000), 0);
-  lv_obj_set_style_bg_opa(new_scr, LV_OPA_COVER, 0);
-
-  // Dynamic Glow
-  uint32_t glow_color = 0x111111;
-  int code = data.currentWeatherCode;
-  if (code == 0 || code == 1)
-    glow_color = 0x001F3F;
-  else if (code == 2 || code == 3)
-    glow_color = 0x222222;
-  else if (code >= 51 && code <= 67)
-    glow_color = 0x0C192C;
-  else if (code >= 95)
-    glow_color = 0x1A0033;
+  Theme::add(new_scr, &Theme::screen);
 
+  // Dynamic Glow (color set by apply())
   lv_obj_t *bg_grad = lv_obj_create(new_scr);
   lv_obj_set_size(bg_grad, LV_PCT(100), LV_PCT(100));
-  lv_obj_set_style_bg_color(bg_grad, lv_color_hex(glow_color), 0);
+  lv_obj_set_style_bg_color(bg_grad, lv_color_hex(0x111111), 0);
   lv_obj_set_style_bg_grad_color(bg_grad, lv_color_hex(0x000000), 0);
   lv_obj_set_style_bg_grad_dir(bg_grad, LV_GRAD_DIR_VER, 0);
   lv_obj_set_style_bg_opa(bg_grad, LV_OPA_COVER, 0);
   lv_obj_set_style_border_width(bg_grad, 0, 0);
   lv_obj_set_style_pad_all(bg_grad, 0, 0); // Fix: Remove default padding
   lv_obj_clear_flag(bg_grad, LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_add_event_cb(bg_grad, onRootDeleted, LV_EVENT_DELETE, NULL);
+  w.root = bg_grad;
 
   // Click & Gesture Handlers
   lv_obj_add_flag(bg_grad, LV_OBJ_FLAG_CLICKABLE);
@@ -161,67 +215,26 @@ void WeatherView::show(const WeatherData &data, int anim, int forecastMode) {
   lv_obj_add_event_cb(new_scr, GuiController::handleGesture, LV_EVENT_GESTURE,
                       NULL);
 
-  auto getWindDir = [](int deg) -> const char * {
-    const char *dirs[] = {"N", "NE", "E", "SE", "S", "SW", "W", "NW"};
-    return dirs[((deg + 22) % 360) / 45];
-  };
-
   // === COMMON HEADER ===
   lv_obj_t *header_row = lv_obj_create(bg_grad);
-  lv_obj_set_size(header_row, LV_PCT(100), 40);
-  lv_obj_align(header_row, LV_ALIGN_TOP_MID, 0, 0);
-  lv_obj_set_style_bg_opa(header_row, LV_OPA_TRANSP, 0);
-  lv_obj_set_style_border_width(header_row, 0, 0);
-  lv_obj_set_style_pad_all(header_row, 5, 0);
+  Theme::add(header_row, &Theme::header);
   lv_obj_clear_flag(header_row, LV_OBJ_FLAG_SCROLLABLE);
   lv_obj_add_flag(header_row, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_EVENT_BUBBLE |
                                   LV_OBJ_FLAG_GESTURE_BUBBLE);
 
-  lv_obj_t *city_lbl = lv_label_create(header_row);
-  lv_obj_set_width(city_lbl, 160); // Reduced to 160 as per user request
-  lv_label_set_long_mode(city_lbl, LV_LABEL_LONG_SCROLL_CIRCULAR);
-  lv_obj_set_style_text_color(city_lbl, lv_color_hex(0x00FFFF), 0);
-  lv_obj_set_style_text_font(city_lbl, &lv_font_montserrat_20, 0);
-  lv_obj_align(city_lbl, LV_ALIGN_TOP_LEFT, 0, 0);
-
-  String titleText = String(data.cityName.length() > 0
-                                ? GuiController::sanitize(data.cityName).c_str()
-                                : "Unknown");
-  if (forecastMode == 1)
-    titleText += " - Hourly";
-  else if (forecastMode == 2)
-    titleText += " - 7 Days";
-  lv_label_set_text(city_lbl, titleText.c_str());
+  w.city = lv_label_create(header_row);
+  lv_label_set_long_mode(w.city, LV_LABEL_LONG_SCROLL_CIRCULAR);
+  Theme::add(w.city, &Theme::title);
 
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo, 10)) {
-    char timeStr[16];
-    strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-    lv_obj_t *time_lbl = lv_label_create(header_row);
-    lv_label_set_text(time_lbl, timeStr);
-    lv_obj_set_style_text_color(time_lbl, lv_color_hex(0xAAAAAA), 0);
-    lv_obj_set_style_text_font(time_lbl, &lv_font_montserrat_20, 0);
-    lv_obj_align(time_lbl, LV_ALIGN_TOP_RIGHT, 0, 0);
-    GuiController::setActiveTimeLabel(time_lbl);
-
-    // Status Dot
-    // Status Dot
-    lv_obj_t *dot = lv_obj_create(header_row);
-    lv_obj_set_size(dot, 10, 8); // Wider
-    lv_obj_set_style_radius(dot, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(dot, 0, 0);
-    lv_obj_align_to(dot, time_lbl, LV_ALIGN_OUT_LEFT_MID, -7, 0); // Right 1px
-    lv_obj_clear_flag(dot, LV_OBJ_FLAG_SCROLLABLE);
-
-    uint32_t dotColor = 0x00AA00; // Dark Green (Fresh)
-    if (DataManager::isWeatherUpdating(GuiController::getCityIndex())) {
-      dotColor = 0xFFFF00; // Yellow (Refreshing)
-    } else if (data.lastUpdate == 0 ||
-               (millis() - data.lastUpdate > 900000)) { // 15 mins or Never
-      dotColor = 0xFF0000;                              // Red (Stale)
-    }
-    lv_obj_set_style_bg_color(dot, lv_color_hex(dotColor), 0);
-  }
+  w.time = lv_label_create(header_row);
+  lv_label_set_text(w.time, "--:--");
+  Theme::add(w.time, &Theme::clock);
+
+  // Status Dot
+  w.dot = lv_obj_create(header_row);
+  Theme::add(w.dot, &Theme::dot);
+  lv_obj_align_to(w.dot, w.time, LV_ALIGN_OUT_LEFT_MID, -7, 0); // Right 1px
+  lv_obj_clear_flag(w.dot, LV_OBJ_FLAG_SCROLLABLE);
 
   if (forecastMode == 0) {
     // === CURRENT WEATHER ===
@@ -250,154 +263,244 @@ void WeatherView::show(const WeatherData &data, int anim, int forecastMode) {
 
     lv_obj_t *icon_wrap = lv_obj_create(glass_card);
     lv_obj_set_size(icon_wrap, 50, 50); // Reduced 60->50 to save vertical space
-    lv_obj_set_style_bg_opa(icon_wrap, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(icon_wrap, 0, 0);
+    Theme::add(icon_wrap, &Theme::bare);
     lv_obj_clear_flag(icon_wrap,
                       LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-    createWeatherIcon(icon_wrap, data.currentWeatherCode, data.isNight);
-    if (lv_obj_get_child(icon_wrap, 0))
-      lv_img_set_zoom(lv_obj_get_child(icon_wrap, 0),
-                      220); // Zoom 256->220 (approx 0.85x)
+    w.icon = lv_img_create(icon_wrap);
+    Theme::add(w.icon, &Theme::icon);
+    lv_img_set_zoom(w.icon, 220); // Zoom 256->220 (approx 0.85x)
 
     // Temp Row
     lv_obj_t *temp_row = lv_obj_create(glass_card);
     lv_obj_set_size(temp_row, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(temp_row, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(temp_row, 0, 0);
+    Theme::add(temp_row, &Theme::bare);
     lv_obj_set_flex_flow(temp_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(temp_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
                           LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_all(temp_row, 0, 0);
     lv_obj_set_style_pad_column(temp_row, 8, 0);
     lv_obj_clear_flag(temp_row, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
 
     // Temp
-    lv_obj_t *temp_lbl = lv_label_create(temp_row);
-    snprintf(buf, sizeof(buf), "%.1f°C", data.currentTemp);
-    lv_label_set_text(temp_lbl, buf);
-    lv_obj_set_style_text_font(temp_lbl, &lv_font_montserrat_32,
+    w.temp = lv_label_create(temp_row);
+    lv_obj_set_style_text_font(w.temp, &lv_font_montserrat_32,
                                0); // Upgrade 24->32
-    lv_obj_set_style_text_color(temp_lbl, lv_color_hex(0xFFFFFF), 0);
+    Theme::add(w.temp, &Theme::textWhite);
 
     // Right Arrow - Floating to keep Temp centered
-    lv_obj_t *arrow_r = lv_label_create(temp_row);
-    lv_obj_add_flag(arrow_r, LV_OBJ_FLAG_FLOATING);
-    lv_obj_align(arrow_r, LV_ALIGN_RIGHT_MID, -10,
+    w.arrow = lv_label_create(temp_row);
+    lv_obj_add_flag(w.arrow, LV_OBJ_FLAG_FLOATING);
+    lv_obj_align(w.arrow, LV_ALIGN_RIGHT_MID, -10,
                  0); // Add 10px padding from right edge
-    float diffR = data.daily[1].maxTemp - data.daily[0].maxTemp;
-    if (diffR >= 1.0) {
-      lv_label_set_text(arrow_r, LV_SYMBOL_UP);
-      lv_obj_set_style_text_color(arrow_r, lv_color_hex(0xFF5555), 0);
-    } else if (diffR <= -1.0) {
-      lv_label_set_text(arrow_r, LV_SYMBOL_DOWN);
-      lv_obj_set_style_text_color(arrow_r, lv_color_hex(0x5555FF), 0);
-    } else {
-      lv_label_set_text(arrow_r, "-");
-      lv_obj_set_style_text_color(arrow_r, lv_color_hex(0x888888), 0);
-    }
 
     // H/L
-    lv_obj_t *hl_lbl = lv_label_create(glass_card);
-    snprintf(buf, sizeof(buf), "H:%.0f° L:%.0f°", data.daily[0].maxTemp,
-             data.daily[0].minTemp);
-    lv_label_set_text(hl_lbl, buf); // Restored!
-    lv_obj_set_style_text_font(hl_lbl, &lv_font_montserrat_16,
+    w.hiLo = lv_label_create(glass_card);
+    lv_obj_set_style_text_font(w.hiLo, &lv_font_montserrat_16,
                                0); // Upgrade H/L 14->16
-    lv_obj_set_style_text_color(hl_lbl, lv_color_hex(0xCCCCCC), 0);
-    lv_obj_set_style_pad_top(hl_lbl, 0, 0);
+    lv_obj_set_style_text_color(w.hiLo, lv_color_hex(0xCCCCCC), 0);
+    lv_obj_set_style_pad_top(w.hiLo, 0, 0);
 
-    // Desc
     // Desc Container (Desc + Rain%)
     lv_obj_t *desc_row = lv_obj_create(glass_card);
     lv_obj_set_size(desc_row, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(desc_row, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(desc_row, 0, 0);
+    Theme::add(desc_row, &Theme::bare);
     lv_obj_set_flex_flow(desc_row, LV_FLEX_FLOW_ROW);
     lv_obj_set_flex_align(desc_row, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
                           LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_all(desc_row, 0, 0);
     lv_obj_set_style_pad_top(desc_row, 2, 0);
     lv_obj_clear_flag(desc_row, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
 
     // Weather Description
-    lv_obj_t *desc_lbl = lv_label_create(desc_row);
-    lv_label_set_text(desc_lbl, getWeatherDesc(data.currentWeatherCode));
-    lv_obj_set_style_text_color(desc_lbl, lv_color_hex(0xFFD700), 0);
-    lv_obj_set_style_text_font(desc_lbl, &lv_font_montserrat_16, 0);
+    w.desc = lv_label_create(desc_row);
+    lv_obj_set_style_text_color(w.desc, lv_color_hex(0xFFD700), 0);
+    lv_obj_set_style_text_font(w.desc, &lv_font_montserrat_16, 0);
 
-    // Rain % (Appended)
-    if (data.currentRainProb > 0.0) {
-      lv_obj_t *rain_appended = lv_label_create(desc_row);
-      char rBuf[16];
-      snprintf(rBuf, sizeof(rBuf), " %.0f%%",
-               data.currentRainProb * 100.0); // Space prefix
-      lv_label_set_text(rain_appended, rBuf);
-      lv_obj_set_style_text_color(rain_appended, lv_color_hex(0x00BFFF),
-                                  0); // Blue
-      lv_obj_set_style_text_font(rain_appended, &lv_font_montserrat_16, 0);
-    }
+    // Rain % (Appended, hidden when dry)
+    w.rain = lv_label_create(desc_row);
+    lv_obj_set_style_text_color(w.rain, lv_color_hex(0x00BFFF), 0); // Blue
+    lv_obj_set_style_text_font(w.rain, &lv_font_montserrat_16, 0);
+    lv_obj_add_flag(w.rain, LV_OBJ_FLAG_HIDDEN);
 
     // Pills
     lv_obj_t *details_cont = lv_obj_create(bg_grad);
     lv_obj_set_size(details_cont, 220, 90);
     lv_obj_align(details_cont, LV_ALIGN_BOTTOM_MID, 0,
                  -2); // Moved lower -15 -> -2
-    lv_obj_set_style_bg_opa(details_cont, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(details_cont, 0, 0);
+    Theme::add(details_cont, &Theme::bare);
     lv_obj_set_flex_flow(details_cont, LV_FLEX_FLOW_ROW_WRAP);
     lv_obj_set_flex_align(details_cont, LV_FLEX_ALIGN_SPACE_BETWEEN,
                           LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_all(details_cont, 0, 0);
     lv_obj_clear_flag(details_cont, LV_OBJ_FLAG_SCROLLABLE);
     lv_obj_add_flag(details_cont, LV_OBJ_FLAG_CLICKABLE |
                                       LV_OBJ_FLAG_EVENT_BUBBLE |
                                       LV_OBJ_FLAG_GESTURE_BUBBLE);
 
-    auto add_pill = [&](const char *label, const char *value, uint32_t color) {
+    // Returns the caption label; the value label goes to *value
+    auto add_pill = [&](const char *label, uint32_t color,
+                        lv_obj_t **value) -> lv_obj_t * {
       lv_obj_t *pill = lv_obj_create(details_cont);
-      lv_obj_set_size(pill, 105, 40);
-      lv_obj_set_style_bg_color(pill, lv_color_hex(0x202020), 0);
-      lv_obj_set_style_bg_opa(pill, LV_OPA_80, 0);
-      lv_obj_set_style_radius(pill, 10, 0);
-      lv_obj_set_style_border_width(pill, 2, 0); // Increased 1->2
-      lv_obj_set_style_border_color(pill, lv_color_hex(0x777777),
-                                    0); // Lighter 55->77
-      lv_obj_set_style_border_opa(pill, LV_OPA_70, 0);
-      lv_obj_set_flex_flow(pill, LV_FLEX_FLOW_COLUMN);
-      lv_obj_set_flex_align(pill, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER,
-                            LV_FLEX_ALIGN_CENTER);
-      lv_obj_set_style_pad_all(pill, 0, 0);
-      lv_obj_set_style_pad_row(pill, 0, 0); // Added: Remove gap between lines
+      Theme::add(pill, &Theme::pill);
+      Theme::add(pill, &Theme::card);
       lv_obj_clear_flag(pill, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
 
       lv_obj_t *v = lv_label_create(pill);
-      lv_label_set_text(v, value);
+      Theme::add(v, &Theme::pillValue);
       lv_obj_set_style_text_color(v, lv_color_hex(color), 0);
-      lv_obj_set_style_text_font(v, &lv_font_montserrat_16,
-                                 0); // Upgrade 14->16
+      *value = v;
 
       lv_obj_t *l = lv_label_create(pill);
       lv_label_set_text(l, label);
-      lv_obj_set_style_text_color(l, lv_color_hex(0xDDDDDD),
-                                  0); // Brighter Grey
-      lv_obj_set_style_text_font(l, &lv_font_montserrat_16,
-                                 0); // Upgrade 14->16
+      Theme::add(l, &Theme::pillLabel);
+      return l;
     };
 
+    add_pill("Humidity", 0xFFFFFF, &w.pillValue[0]);
+    w.windLabel = add_pill("Wind", 0x90EE90, &w.pillValue[1]);
+    add_pill("Pressure", 0xFFFFFF, &w.pillValue[2]);
+    add_pill("Quality", 0x00FF00, &w.pillValue[3]);
+
+  } else if (forecastMode == 1 || forecastMode == 2) {
+    // === LIST VIEWS ===
+    // Rows are created and bound by the VirtualList (createRow / bindRow)
+    lv_obj_t *cont =
+        lists[forecastMode].create(bg_grad, 260, 45, createRow, bindRow);
+    Theme::add(cont, &Theme::bare);
+    lv_obj_align(cont, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_EVENT_BUBBLE);
+    w.rowCount = forecastMode == 1 ? HOURLY_ROWS : DAILY_ROWS;
+  }
+}
+
+void WeatherView::createRow(lv_obj_t *row, int slot) {
+  Widgets &w = owner(row);
+  Row &r = w.rows[slot];
+  Theme::add(row, &Theme::forecastRow);
+  Theme::add(row, &Theme::card);
+  Theme::add(row, &Theme::rowBg[slot % 2]); // Darker alternating
+  Theme::add(row, &Theme::translucent);
+  lv_obj_add_flag(row, LV_OBJ_FLAG_CLICKABLE);
+
+  // Time/Day
+  r.time = lv_label_create(row);
+  Theme::add(r.time, &Theme::forecastTime);
+
+  // Icon
+  lv_obj_t *icon_box = lv_obj_create(row);
+  Theme::add(icon_box, &Theme::bare);
+  Theme::add(icon_box, &Theme::iconBox);
+  lv_obj_clear_flag(icon_box, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+  r.icon = lv_img_create(icon_box);
+  Theme::add(r.icon, &Theme::icon);
+  lv_img_set_zoom(r.icon, 160);
+
+  // Rain Prob (List)
+  r.rain = lv_label_create(row);
+  Theme::add(r.rain, &Theme::forecastRain);
+  lv_label_set_text(r.rain, "");
+
+  // Trend
+  if (w.mode == 2) {
+    r.trend = lv_label_create(row);
+    Theme::add(r.trend, &Theme::forecastTrend);
+    lv_label_set_text(r.trend, "");
+  }
+
+  // Temp
+  r.temp = lv_label_create(row);
+  Theme::add(r.temp, &Theme::textWhite);
+}
+
+// --- APPLY (every update) ---
+
+void WeatherView::apply(Widgets &w, const WeatherData &data) {
+  char buf[128];
+
+  auto getWindDir = [](int deg) -> const char * {
+    const char *dirs[] = {"N", "NE", "E", "SE", "S", "SW", "W", "NW"};
+    return dirs[((deg + 22) % 360) / 45];
+  };
+
+  // Dynamic Glow
+  uint32_t glow_color = 0x111111;
+  int code = data.currentWeatherCode;
+  if (code == 0 || code == 1)
+    glow_color = 0x001F3F;
+  else if (code == 2 || code == 3)
+    glow_color = 0x222222;
+  else if (code >= 51 && code <= 67)
+    glow_color = 0x0C192C;
+  else if (code >= 95)
+    glow_color = 0x1A0033;
+  setBgColor(w.root, glow_color);
+
+  // Header
+  snprintf(buf, sizeof(buf), "%s%s",
+           data.cityName[0] != '\0' ? data.cityName : "Unknown",
+           w.mode == 1 ? " - Hourly" : (w.mode == 2 ? " - 7 Days" : ""));
+  setText(w.city, buf);
+
+  // Before NTP sync (e.g. cached data shown at boot) keep the header with a
+  // placeholder time so the stale dot is still visible; updateTime() fills
+  // the label in once the clock is set.
+  struct tm timeinfo;
+  bool hasTime = getLocalTime(&timeinfo, 10);
+  bool header = hasTime || data.cityName[0] != '\0';
+  setVisible(w.time, header);
+  setVisible(w.dot, header);
+  if (header) {
+    if (hasTime) {
+      char timeStr[16];
+      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
+      setText(w.time, timeStr);
+    }
+    applyStatus(w, data);
+  }
+
+  if (w.mode == 0) {
+    // === CURRENT WEATHER ===
+    setIcon(w.icon, data.currentWeatherCode, data.isNight);
+
+    snprintf(buf, sizeof(buf), "%.1f°C", data.currentTemp);
+    setText(w.temp, buf);
+
+    float diffR = data.daily[1].maxTemp - data.daily[0].maxTemp;
+    if (diffR >= 1.0) {
+      setText(w.arrow, LV_SYMBOL_UP);
+      setTextColor(w.arrow, 0xFF5555);
+    } else if (diffR <= -1.0) {
+      setText(w.arrow, LV_SYMBOL_DOWN);
+      setTextColor(w.arrow, 0x5555FF);
+    } else {
+      setText(w.arrow, "-");
+      setTextColor(w.arrow, 0x888888);
+    }
+
+    snprintf(buf, sizeof(buf), "H:%.0f° L:%.0f°", data.daily[0].maxTemp,
+             data.daily[0].minTemp);
+    setText(w.hiLo, buf);
+
+    setText(w.desc, getWeatherDesc(data.currentWeatherCode));
+
+    setVisible(w.rain, data.currentRainProb > 0.0);
+    if (data.currentRainProb > 0.0) {
+      snprintf(buf, sizeof(buf), " %.0f%%",
+               data.currentRainProb * 100.0); // Space prefix
+      setText(w.rain, buf);
+    }
+
+    // Pills
     snprintf(buf, sizeof(buf), "%d%%", data.currentHumidity);
-    add_pill("Humidity", buf, 0xFFFFFF);
+    setText(w.pillValue[0], buf);
 
     snprintf(buf, sizeof(buf), "%.1f km/h", data.windSpeed);
-    char windLabel[16];
-    snprintf(windLabel, sizeof(windLabel), "Wind %s",
-             getWindDir(data.windDirection));
-    add_pill(windLabel, buf, 0x90EE90);
+    setText(w.pillValue[1], buf);
+    snprintf(buf, sizeof(buf), "Wind %s", getWindDir(data.windDirection));
+    setText(w.windLabel, buf);
 
     snprintf(buf, sizeof(buf), "%.0f hPa", data.currentPressure);
-    add_pill("Pressure", buf, 0xFFFFFF);
+    setText(w.pillValue[2], buf);
 
-    char aqiBuf[32];
-    snprintf(aqiBuf, sizeof(aqiBuf), "AQI: %d", data.currentAQI);
+    snprintf(buf, sizeof(buf), "AQI: %d", data.currentAQI);
+    setText(w.pillValue[3], buf);
     uint32_t aqiColor = 0x00FF00; // Good (1)
     if (data.currentAQI == 2)
       aqiColor = 0xADFF2F; // Fair (GreenYellow)
@@ -407,133 +510,125 @@ void WeatherView::show(const WeatherData &data, int anim, int forecastMode) {
       aqiColor = 0xFFA500; // Poor (Orange)
     else if (data.currentAQI >= 5)
       aqiColor = 0xFF4500; // Very Poor (OrangeRed)
-    add_pill("Quality", aqiBuf, aqiColor);
+    setTextColor(w.pillValue[3], aqiColor);
 
-  } else if (forecastMode == 1 || forecastMode == 2) {
+  } else {
     // === LIST VIEWS ===
-    bool isHourly = (forecastMode == 1);
-
-    lv_obj_t *list = lv_obj_create(bg_grad);
-    lv_obj_set_size(list, LV_PCT(100), 260);
-    lv_obj_align(list, LV_ALIGN_BOTTOM_MID, 0, 0);
-    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_bg_opa(list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(list, 0, 0);
-    lv_obj_set_style_pad_all(list, 0, 0);
-    lv_obj_add_flag(list, LV_OBJ_FLAG_EVENT_BUBBLE);
-
-    int count = isHourly ? 24 : 7;
-    for (int i = 0; i < count; i++) {
-      lv_obj_t *row = lv_obj_create(list);
-      lv_obj_set_size(row, LV_PCT(100), 45);
-      lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-      lv_obj_set_flex_align(row, LV_FLEX_ALIGN_SPACE_BETWEEN,
-                            LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-      lv_obj_set_style_bg_color(row,
-                                lv_color_hex((i % 2) ? 0x202020 : 0x101010),
-                                0);               // Darker alternating
-      lv_obj_set_style_bg_opa(row, LV_OPA_80, 0); // High Opacity
-      lv_obj_set_style_border_width(row, 2, 0);   // 1->2
-      lv_obj_set_style_border_color(row, lv_color_hex(0x777777), 0);
-      lv_obj_set_style_border_opa(row, LV_OPA_70, 0);
-      lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
-      lv_obj_add_flag(row, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_EVENT_BUBBLE);
-
-      // Time/Day
-      lv_obj_t *time_lbl = lv_label_create(row);
-      lv_obj_set_width(time_lbl, 60);
-      if (isHourly) {
-        if (data.hourly[i].time.length() > 10)
-          lv_label_set_text(time_lbl,
-                            data.hourly[i].time.substring(11, 16).c_str());
-        else
-          lv_label_set_text(time_lbl, "--:--");
-      } else {
-        if (data.daily[i].date.length() > 0) {
-          char dateBuf[32];
-          formatDate(data.daily[i].date.c_str(), dateBuf);
-          lv_label_set_text(time_lbl, dateBuf);
-        } else
-          lv_label_set_text(time_lbl, "Day");
-      }
-      lv_obj_set_style_text_color(time_lbl, lv_color_hex(0xFFFFFF), 0);
-
-      // Icon
-      lv_obj_t *icon_box = lv_obj_create(row);
-      lv_obj_set_size(icon_box, 40, 40);
-      lv_obj_set_style_bg_opa(icon_box, LV_OPA_TRANSP, 0);
-      lv_obj_set_style_border_width(icon_box, 0, 0);
-      lv_obj_set_style_pad_all(icon_box, 0, 0);
-      lv_obj_clear_flag(icon_box,
-                        LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
-      createWeatherIcon(icon_box,
-                        isHourly ? data.hourly[i].weatherCode
-                                 : data.daily[i].weatherCode,
-                        false);
-      if (lv_obj_get_child(icon_box, 0))
-        lv_img_set_zoom(lv_obj_get_child(icon_box, 0), 160);
-
-      // Rain Prob (List)
-      float pop = isHourly ? data.hourly[i].pop : data.daily[i].pop;
-      lv_obj_t *rain_lbl = lv_label_create(row);
-      lv_obj_set_width(rain_lbl, 40);
-      lv_obj_set_style_text_align(rain_lbl, LV_TEXT_ALIGN_CENTER, 0);
-
-      if (pop >= 0.1) { // Show if > 10%
-        char rainBuf[16];
-        snprintf(rainBuf, sizeof(rainBuf), "%.0f%%", pop * 100.0);
-        lv_label_set_text(rain_lbl, rainBuf);
-        lv_obj_set_style_text_color(rain_lbl, lv_color_hex(0x00BFFF), 0);
-        lv_obj_set_style_text_font(rain_lbl, &lv_font_montserrat_14,
-                                   0); // Small font
-      } else {
-        lv_label_set_text(rain_lbl, "");
-      }
+    // Binds the rows in view; the others bind as they scroll in
+    lists[w.mode].setCount(w.rowCount);
+  }
+}
 
-      // Trend
-      if (!isHourly) {
-        lv_obj_t *trend_lbl = lv_label_create(row);
-        lv_obj_set_width(trend_lbl, 20);
-        lv_obj_set_style_text_align(trend_lbl, LV_TEXT_ALIGN_CENTER, 0);
-        if (i > 0) {
-          float diff = data.daily[i].maxTemp - data.daily[i - 1].maxTemp;
-          if (diff >= 1.0) {
-            lv_label_set_text(trend_lbl, LV_SYMBOL_UP);
-            lv_obj_set_style_text_color(trend_lbl, lv_color_hex(0xFF5555), 0);
-          } else if (diff <= -1.0) {
-            lv_label_set_text(trend_lbl, LV_SYMBOL_DOWN);
-            lv_obj_set_style_text_color(trend_lbl, lv_color_hex(0x5555FF), 0);
-          } else {
-            lv_label_set_text(trend_lbl, "");
-          }
-        } else {
-          lv_label_set_text(trend_lbl, "");
-        }
+void WeatherView::bindRow(lv_obj_t *row, int slot, int i) {
+  Widgets &w = owner(row);
+  Row &r = w.rows[slot];
+  const WeatherData &data = *shown;
+  bool isHourly = (w.mode == 1);
+  char buf[32];
+
+  // Time/Day
+  if (isHourly) {
+    if (data.hourly[i].time != 0)
+      formatTime(data.hourly[i].time, buf);
+    else
+      strcpy(buf, "--:--");
+  } else {
+    if (data.daily[i].date != 0)
+      formatDate(data.daily[i].date, buf);
+    else
+      strcpy(buf, "Day");
+  }
+  setText(r.time, buf);
+
+  // Icon
+  setIcon(r.icon,
+          isHourly ? data.hourly[i].weatherCode : data.daily[i].weatherCode,
+          false);
+
+  // Rain Prob (show if > 10%)
+  float pop = isHourly ? data.hourly[i].pop : data.daily[i].pop;
+  if (pop >= 0.1)
+    snprintf(buf, sizeof(buf), "%.0f%%", pop * 100.0);
+  else
+    buf[0] = '\0';
+  setText(r.rain, buf);
+
+  // Trend
+  if (!isHourly) {
+    const char *trend = "";
+    if (i > 0) {
+      float diff = data.daily[i].maxTemp - data.daily[i - 1].maxTemp;
+      if (diff >= 1.0) {
+        trend = LV_SYMBOL_UP;
+        setTextColor(r.trend, 0xFF5555);
+      } else if (diff <= -1.0) {
+        trend = LV_SYMBOL_DOWN;
+        setTextColor(r.trend, 0x5555FF);
       }
+    }
+    setText(r.trend, trend);
+  }
+
+  // Temp
+  if (isHourly)
+    snprintf(buf, sizeof(buf), "%.1f°", data.hourly[i].temp);
+  else
+    snprintf(buf, sizeof(buf), "%.0f°/%.0f°", data.daily[i].minTemp,
+             data.daily[i].maxTemp);
+  setText(r.temp, buf);
+}
 
-      // Temp
-      lv_obj_t *temp_lbl = lv_label_create(row);
-      if (isHourly)
-        snprintf(buf, sizeof(buf), "%.1f°", data.hourly[i].temp);
-      else
-        snprintf(buf, sizeof(buf), "%.0f°/%.0f°", data.daily[i].minTemp,
-                 data.daily[i].maxTemp);
-      lv_label_set_text(temp_lbl, buf);
-      lv_obj_set_style_text_color(temp_lbl, lv_color_hex(0xFFFFFF), 0);
+void WeatherView::applyStatus(Widgets &w, const WeatherData &data) {
+  uint32_t dotColor = 0x00AA00; // Dark Green (Fresh)
+  if (DataManager::isWeatherUpdating(GuiController::getCityIndex())) {
+    dotColor = 0xFFFF00; // Yellow (Refreshing)
+  } else if (data.lastUpdate == 0 ||
+             (millis() - data.lastUpdate > 900000)) { // 15 mins or Never
+    dotColor = 0xFF0000;                              // Red (Stale)
+  }
+  setBgColor(w.dot, dotColor);
+}
+
+lv_obj_t *WeatherView::update(const WeatherData &data, int forecastMode) {
+  Widgets &w = modes[forecastMode];
+  if (w.root) {
+    refresh(data);
+    return w.screen;
+  }
+
+  uint32_t t0 = micros();
+  uint32_t heap0 = ESP.getFreeHeap();
+  build(forecastMode);
+  refresh(data); // Also creates the list rows in view
+  Serial.printf("GUI: Weather mode %d built: %u objects, %u B heap, %u us\n",
+                forecastMode, GuiController::countObjects(w.screen),
+                (unsigned)(heap0 - ESP.getFreeHeap()),
+                (unsigned)(micros() - t0));
+  return w.screen;
+}
+
+void WeatherView::refresh(const WeatherData &data) {
+  // Every resident mode, shown or not: a diff against the live widgets, so
+  // LVGL invalidates just the changed areas (nothing while hidden).
+  uint32_t t0 = micros();
+  int screens = 0;
+  changes = 0;
+  shown = &data;
+  for (int m = 0; m < MODE_COUNT; m++) {
+    if (modes[m].root) {
+      apply(modes[m], data);
+      screens++;
     }
   }
+  if (screens)
+    Serial.printf("GUI: Weather diff: %u widgets changed on %d screen%s, "
+                  "%u us\n",
+                  changes, screens, screens == 1 ? "" : "s",
+                  (unsigned)(micros() - t0));
+}
 
-  // Animation
-  lv_scr_load_anim_t anim_type = LV_SCR_LOAD_ANIM_NONE;
-  if (anim == 1)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_LEFT;
-  else if (anim == -1)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_RIGHT;
-  else if (anim == 2)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_BOTTOM;
-  else if (anim == -2)
-    anim_type = LV_SCR_LOAD_ANIM_MOVE_TOP;
-
-  int time = (anim == 0) ? 0 : 300;
-  lv_scr_load_anim(new_scr, anim_type, time, 0, true);
+void WeatherView::refreshStatus() {
+  for (int m = 0; m < MODE_COUNT; m++)
+    if (modes[m].root && !lv_obj_has_flag(modes[m].dot, LV_OBJ_FLAG_HIDDEN))
+      applyStatus(modes[m], *shown);
 }
@@ -1,16 +1,86 @@
 #pragma once
 
+#include "VirtualList.h"
 #include "WeatherService.h"
 #include "lvgl.h"
 #include "weather_icons.h"
 #include <Arduino.h>
 
+// Retained-mode view: the widget tree is built once per forecast mode and
+// kept while the screen is alive; later update() calls only push changed
+// fields into the existing widgets, so LVGL invalidates just those areas.
+// The hourly/daily lists are VirtualLists: all 24 hours scroll through a
+// fixed pool of rows. Each forecast mode has its own tree, kept until the
+// screen cache drops it, so switching modes is a screen load.
 class WeatherView {
 public:
-  static void show(const WeatherData &data, int anim, int forecastMode);
+  static const int MODE_COUNT = 3; // Current, hourly, daily
+
+  // Builds `forecastMode` if needed, updates every resident mode and returns
+  // the mode's screen (not loaded); rows keep referring to `data`
+  static lv_obj_t *update(const WeatherData &data, int forecastMode);
+  static void refresh(const WeatherData &data); // Resident modes, no build
+  static void refreshStatus();                  // Status dots only
+
+  // NULL until built
+  static lv_obj_t *screen(int mode) { return modes[mode].screen; }
+  static lv_obj_t *timeLabel(int mode) { return modes[mode].time; }
 
 private:
-  static void createWeatherIcon(lv_obj_t *parent, int code, bool isNight);
+  static const int HOURLY_ROWS = 24;
+  static const int DAILY_ROWS = 7;
+
+  struct Row {
+    lv_obj_t *time;
+    lv_obj_t *icon;
+    lv_obj_t *rain;
+    lv_obj_t *trend; // Daily only
+    lv_obj_t *temp;
+  };
+
+  // Widget handles, valid while root != NULL
+  struct Widgets {
+    lv_obj_t *screen;
+    lv_obj_t *root; // Background gradient; its deletion resets everything
+    int mode;
+    lv_obj_t *city;
+    lv_obj_t *time;
+    lv_obj_t *dot;
+    // Current
+    lv_obj_t *icon;
+    lv_obj_t *temp;
+    lv_obj_t *arrow;
+    lv_obj_t *hiLo;
+    lv_obj_t *desc;
+    lv_obj_t *rain;
+    lv_obj_t *pillValue[4];
+    lv_obj_t *windLabel;
+    // Hourly / daily, per VirtualList pool slot
+    Row rows[VirtualList::MAX_POOL];
+    int rowCount;
+  };
+  static Widgets modes[MODE_COUNT];
+  static VirtualList lists[MODE_COUNT]; // Hourly and daily
+  static const WeatherData *shown;      // Bound by the list rows
+  static uint16_t changes; // Widgets touched by the last refresh()
+
+  static void build(int forecastMode);
+  static void apply(Widgets &w, const WeatherData &data);
+  static void applyStatus(Widgets &w, const WeatherData &data);
+  static Widgets &owner(lv_obj_t *row); // List row -> its mode's widgets
+  static void createRow(lv_obj_t *row, int slot);
+  static void bindRow(lv_obj_t *row, int slot, int i);
+  static void onRootDeleted(lv_event_t *e);
+
+  static void setText(lv_obj_t *label, const char *text);
+  static void setTextColor(lv_obj_t *obj, uint32_t color);
+  static void setBgColor(lv_obj_t *obj, uint32_t color);
+  static void setVisible(lv_obj_t *obj, bool visible);
+  static void setIcon(lv_obj_t *img, int code, bool isNight);
+
+  static void iconFor(int code, bool isNight, const void **src,
+                      uint32_t *color);
   static const char *getWeatherDesc(int code);
-  static void formatDate(const char *input, char *output);
+  static void formatDate(uint32_t date, char *output); // YYYYMMDD -> "14 Mar"
+  static void formatTime(uint32_t epoch, char *output); // -> "HH:MM" local
 };
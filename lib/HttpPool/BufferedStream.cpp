@@ -0,0 +1,174 @@
+#include "BufferedStream.h"
+
+void BufferedStream::begin(WiFiClient *client, uint8_t *buffer, size_t size,
+                           bool chunked, int contentLength,
+                           uint32_t timeoutMs) {
+  this->client = client;
+  buf = buffer;
+  cap = size;
+  pos = len = 0;
+  this->chunked = chunked;
+  eof = (client == nullptr);
+  complete = false;
+  body = raw = 0;
+  setTimeout(timeoutMs);
+
+  if (chunked)
+    left = 0; // First chunk header is read on demand
+  else if (contentLength >= 0)
+    left = contentLength;
+  else
+    left = SIZE_MAX; // Close-delimited: read until the server hangs up
+
+  if (!chunked && left == 0) {
+    eof = true;
+    complete = true;
+  }
+}
+
+// Refill the buffer with at most `want` bytes, waiting up to the stream
+// timeout. Never reads past the current chunk/body, so nothing belonging to
+// the next response on a keep-alive socket is swallowed.
+bool BufferedStream::fillRaw(size_t want) {
+  uint32_t start = millis();
+  if (want > cap)
+    want = cap;
+  while (true) {
+    int avail = client->available();
+    if (avail > 0) {
+      int n = client->read(buf, (size_t)avail < want ? avail : want);
+      if (n > 0) {
+        pos = 0;
+        len = n;
+        raw += n;
+        return true;
+      }
+    }
+    if (!client->connected() || millis() - start >= _timeout)
+      return false;
+    delay(1);
+  }
+}
+
+// Chunk framing is read a byte at a time (a few bytes per chunk)
+int BufferedStream::rawByte() {
+  if (pos == len && !fillRaw(1))
+    return -1;
+  return buf[pos++];
+}
+
+// Parse "<hex size>[;ext]\r\n". Size 0 is the last chunk, followed by
+// optional trailer lines and an empty line.
+bool BufferedStream::nextChunk() {
+  int c = rawByte();
+  while (c == '\r' || c == '\n') // CRLF closing the previous chunk
+    c = rawByte();
+
+  size_t size = 0;
+  bool digits = false;
+  while (c >= 0 && isxdigit(c)) {
+    size = size * 16 + (isdigit(c) ? c - '0' : (tolower(c) - 'a' + 10));
+    digits = true;
+    c = rawByte();
+  }
+  while (c >= 0 && c != '\n') // Chunk extensions + CR
+    c = rawByte();
+
+  if (c < 0 || !digits) {
+    eof = true; // Truncated or malformed framing
+    return false;
+  }
+
+  if (size == 0) {
+    int lineLen;
+    do {
+      lineLen = 0;
+      while ((c = rawByte()) >= 0 && c != '\n') {
+        if (c != '\r')
+          lineLen++;
+      }
+    } while (c >= 0 && lineLen > 0);
+    eof = true;
+    complete = (c >= 0);
+    return false;
+  }
+
+  left = size;
+  return true;
+}
+
+// Number of contiguous body bytes ready in the buffer (0 = end of body)
+size_t BufferedStream::ensure() {
+  if (eof)
+    return 0;
+  if (left == 0) {
+    if (!chunked) {
+      eof = true;
+      complete = true;
+      return 0;
+    }
+    if (!nextChunk())
+      return 0;
+  }
+  if (pos == len && !fillRaw(left)) {
+    eof = true;
+    complete = (left == SIZE_MAX && !client->connected());
+    return 0;
+  }
+  size_t n = len - pos;
+  return n < left ? n : left;
+}
+
+int BufferedStream::available() {
+  if (eof)
+    return 0;
+  size_t n = len - pos;
+  if (n == 0)
+    n = client->available();
+  if (n > left && left > 0)
+    n = left;
+  return n;
+}
+
+int BufferedStream::read() {
+  if (!ensure())
+    return -1;
+  left--;
+  body++;
+  return buf[pos++];
+}
+
+int BufferedStream::peek() {
+  if (!ensure())
+    return -1;
+  return buf[pos];
+}
+
+size_t BufferedStream::readBytes(char *buffer, size_t length) {
+  size_t copied = 0;
+  while (copied < length) {
+    size_t n = ensure();
+    if (!n)
+      break;
+    if (n > length - copied)
+      n = length - copied;
+    memcpy(buffer + copied, buf + pos, n);
+    pos += n;
+    left -= n;
+    copied += n;
+  }
+  body += copied;
+  return copied;
+}
+
+bool BufferedStream::finish(size_t maxBytes) {
+  size_t drained = 0;
+  size_t n;
+  while (drained < maxBytes && (n = ensure()) > 0) {
+    pos += n;
+    left -= n;
+    drained += n;
+  }
+  eof = true;
+  return complete;
+}
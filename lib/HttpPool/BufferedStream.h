@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+
+// Read-buffering Stream over an HTTP response body.
+// Pulls the socket in buffer-sized reads instead of one virtual read() per
+// byte, and strips "Transfer-Encoding: chunked" framing on the fly so the
+// JSON parser always sees the plain body (no need for useHTTP10()).
+// The buffer is supplied by the owner (HttpPool keeps a single one for the
+// network task), so only one BufferedStream may be active at a time.
+class BufferedStream : public Stream {
+public:
+  // contentLength: -1 when unknown (chunked or close-delimited)
+  void begin(WiFiClient *client, uint8_t *buffer, size_t size, bool chunked,
+             int contentLength, uint32_t timeoutMs);
+
+  // Consumes the rest of the body (up to maxBytes) so the keep-alive socket
+  // is positioned at the next response. False: socket is not reusable.
+  bool finish(size_t maxBytes = 8192);
+
+  size_t bodyBytes() const { return body; } // Decoded bytes handed out
+  size_t rawBytes() const { return raw; }   // Bytes pulled off the socket
+
+  // Stream
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  size_t write(uint8_t) override { return 0; }
+  void flush() override {}
+
+private:
+  WiFiClient *client = nullptr;
+  uint8_t *buf = nullptr;
+  size_t cap = 0;
+  size_t pos = 0, len = 0;
+
+  bool chunked = false;
+  bool eof = true;
+  bool complete = false; // Reached the real end of the body
+  size_t left = 0;       // Bytes left in the current chunk / whole body
+
+  size_t body = 0;
+  size_t raw = 0;
+
+  bool fillRaw(size_t want);
+  int rawByte();
+  bool nextChunk();
+  size_t ensure();
+};
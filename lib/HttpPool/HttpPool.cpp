@@ -0,0 +1,181 @@
+#include "HttpPool.h"
+
+HttpPool::Slot HttpPool::slots[HTTP_POOL_SIZE];
+uint32_t HttpPool::handshakes = 0;
+uint32_t HttpPool::reusedRequests = 0;
+
+uint8_t HttpPool::streamBuf[HTTP_STREAM_BUFFER];
+BufferedStream HttpPool::body;
+HTTPClient *HttpPool::bodyHttp = nullptr;
+NetEndpoint HttpPool::bodyEp = EP_COUNT;
+uint32_t HttpPool::bodyStart = 0;
+
+// Response headers BufferedStream needs to frame the body
+static const char *streamHeaders[] = {"Transfer-Encoding"};
+
+String HttpPool::hostOf(const String &url) {
+  // "https://api.openweathermap.org/data/2.5/..." -> "api.openweathermap.org"
+  int start = url.indexOf("://");
+  start = (start == -1) ? 0 : start + 3;
+  int end = url.indexOf('/', start);
+  if (end == -1)
+    end = url.length();
+  return url.substring(start, end);
+}
+
+HttpPool::Slot *HttpPool::findSlot(HTTPClient *http) {
+  for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+    if (&slots[i].http == http)
+      return &slots[i];
+  }
+  return nullptr;
+}
+
+void HttpPool::closeSlot(Slot &slot) {
+  slot.http.end();
+  slot.client->stop();
+  slot.host = "";
+  slot.inUse = false;
+}
+
+HTTPClient *HttpPool::begin(const String &url, NetEndpoint ep,
+                            uint16_t timeoutMs) {
+  String host = hostOf(url);
+  bool secure = !url.startsWith("http://");
+
+  // 1. Same host already pooled?
+  Slot *slot = nullptr;
+  for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+    if (!slots[i].inUse && slots[i].host == host &&
+        slots[i].secure == secure) {
+      slot = &slots[i];
+      break;
+    }
+  }
+
+  // 2. Otherwise take an empty slot, or evict the least recently used one
+  if (!slot) {
+    for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+      if (slots[i].inUse)
+        continue;
+      if (slots[i].host.isEmpty()) {
+        slot = &slots[i];
+        break;
+      }
+      if (!slot || slots[i].lastUsed < slot->lastUsed)
+        slot = &slots[i];
+    }
+    if (!slot) { // All slots busy (caller leaked a client)
+      Serial.printf("HTTPPOOL: No free client for %s\n", host.c_str());
+      return nullptr;
+    }
+    closeSlot(*slot);
+    slot->host = host;
+    slot->secure = secure;
+    slot->client = secure ? &slot->tls : &slot->plain;
+    slot->tls.setInsecure(); // Skip SSL verification
+  }
+
+  slot->inUse = true;
+  slot->timeoutMs = timeoutMs;
+  slot->ep = ep;
+  slot->started = millis();
+  slot->status = 0;
+  slot->http.setReuse(true);
+  slot->http.begin(*slot->client, url);
+  slot->http.setConnectTimeout(timeoutMs);
+  slot->http.setTimeout(timeoutMs);
+  slot->http.collectHeaders(streamHeaders, 1);
+  return &slot->http;
+}
+
+int HttpPool::get(HTTPClient *http) {
+  Slot *slot = findSlot(http);
+  if (!slot)
+    return http->GET();
+
+  bool warm = slot->client->connected();
+  int code = http->GET();
+
+  if (code < 0 && warm) {
+    // Server dropped the idle socket; pay for a fresh handshake
+    slot->client->stop();
+    warm = false;
+    code = http->GET();
+  }
+
+  if (warm)
+    reusedRequests++;
+  else
+    handshakes++;
+  slot->status = code;
+  return code;
+}
+
+Stream &HttpPool::stream(HTTPClient *http) {
+  if (bodyHttp)
+    endStream(); // Previous response was never released
+
+  bool chunked = http->header("Transfer-Encoding").indexOf("chunked") >= 0;
+  Slot *slot = findSlot(http);
+  body.begin(http->getStreamPtr(), streamBuf, sizeof(streamBuf), chunked,
+             chunked ? -1 : http->getSize(), slot ? slot->timeoutMs : 5000);
+  bodyHttp = http;
+  bodyEp = slot ? slot->ep : EP_COUNT;
+  bodyStart = millis();
+  return body;
+}
+
+void HttpPool::endStream() {
+  // Parse throughput: body bytes consumed by the parser / time since GET
+  NetStats::recordStream(bodyEp, body.bodyBytes(), millis() - bodyStart);
+  if (!body.finish()) {
+    // Unread or malformed tail: the socket is not at a response boundary
+    Slot *slot = findSlot(bodyHttp);
+    if (slot)
+      slot->client->stop();
+  }
+  bodyHttp = nullptr;
+}
+
+void HttpPool::release(HTTPClient *http) {
+  if (bodyHttp == http)
+    endStream();
+  Slot *slot = findSlot(http);
+  if (!slot) {
+    http->end();
+    return;
+  }
+  slot->http.end(); // Keeps the socket when the server allows keep-alive
+  slot->lastUsed = millis();
+  slot->inUse = false;
+  NetStats::recordRequest(slot->ep, slot->lastUsed - slot->started,
+                          slot->status);
+}
+
+void HttpPool::closeIdle(uint32_t idleMs) {
+  uint32_t now = millis();
+  for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+    Slot &slot = slots[i];
+    if (slot.inUse || slot.host.isEmpty())
+      continue;
+    if (now - slot.lastUsed > idleMs) {
+      Serial.printf("HTTPPOOL: Closing idle %s\n", slot.host.c_str());
+      closeSlot(slot);
+    }
+  }
+}
+
+void HttpPool::closeAll() {
+  for (int i = 0; i < HTTP_POOL_SIZE; i++) {
+    if (!slots[i].host.isEmpty())
+      closeSlot(slots[i]);
+  }
+}
+
+void HttpPool::printStats() {
+  uint32_t total = handshakes + reusedRequests;
+  Serial.printf("HTTPPOOL: %u requests, %u handshakes, %u reused (%u%%)\n",
+                total, handshakes, reusedRequests,
+                total ? (reusedRequests * 100 / total) : 0);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "BufferedStream.h"
+#include "NetStats.h"
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+
+// Max simultaneously open TLS sockets. Each one pins ~20KB of mbedTLS
+// buffers, so keep this small and close idle sockets between refreshes.
+#ifndef HTTP_POOL_SIZE
+#define HTTP_POOL_SIZE 2
+#endif
+
+// Read buffer shared by all response streams (one response at a time)
+#ifndef HTTP_STREAM_BUFFER
+#define HTTP_STREAM_BUFFER 1024
+#endif
+
+// Per-host keep-alive connection pool.
+// Owned by the network task: not thread-safe, only call from NetTask.
+// https URLs get a TLS socket, plain http ones (tools/replay_server.py) a
+// TCP socket; each request is accounted to its endpoint in NetStats.
+class HttpPool {
+public:
+  // Returns a keep-alive client bound to the url's host, ready for GET().
+  // The client stays owned by the pool; hand it back with release().
+  // nullptr when every client is still checked out: fail the fetch.
+  static HTTPClient *begin(const String &url, NetEndpoint ep,
+                           uint16_t timeoutMs = 5000);
+
+  // GET with handshake/reuse accounting. Retries once on a fresh socket if a
+  // reused one turns out to be dead (server closed it while idle).
+  static int get(HTTPClient *http);
+
+  // Buffered, de-chunked view of the response body. Use instead of
+  // http.getStream(); throughput is recorded on release().
+  static Stream &stream(HTTPClient *http);
+
+  // Ends the request but keeps the socket open for the next one.
+  // An open stream() is drained first so the socket can be reused.
+  // Records the request time and status for its endpoint.
+  static void release(HTTPClient *http);
+
+  // Drop sockets idle for longer than idleMs (frees TLS buffers)
+  static void closeIdle(uint32_t idleMs = 20000);
+  static void closeAll();
+
+  // Stats
+  static uint32_t getHandshakes() { return handshakes; }
+  static uint32_t getReusedRequests() { return reusedRequests; }
+  static void printStats();
+
+private:
+  struct Slot {
+    String host;
+    bool secure = true;
+    WiFiClientSecure tls;
+    WiFiClient plain;
+    WiFiClient *client = &tls; // tls or plain, per the url scheme
+    HTTPClient http;
+    uint32_t lastUsed = 0;
+    uint16_t timeoutMs = 5000;
+    bool inUse = false;
+
+    // Current request
+    NetEndpoint ep = EP_COUNT;
+    uint32_t started = 0;
+    int status = 0;
+  };
+
+  static Slot slots[HTTP_POOL_SIZE];
+
+  // The single active response stream and its buffer
+  static uint8_t streamBuf[HTTP_STREAM_BUFFER];
+  static BufferedStream body;
+  static HTTPClient *bodyHttp;
+  static NetEndpoint bodyEp;
+  static uint32_t bodyStart;
+
+  static uint32_t handshakes;
+  static uint32_t reusedRequests;
+
+  static String hostOf(const String &url);
+  static Slot *findSlot(HTTPClient *http);
+  static void closeSlot(Slot &slot);
+  static void endStream();
+};
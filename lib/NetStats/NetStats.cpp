@@ -0,0 +1,136 @@
+#include "NetStats.h"
+
+NetStats::Entry NetStats::entries[EP_COUNT] = {};
+
+// --- CountingAllocator ---
+// Each block carries its size in a small header so reallocate/deallocate
+// can keep the live byte count exact.
+
+void *CountingAllocator::allocate(size_t size) {
+  uint8_t *p = (uint8_t *)malloc(size + HEADER);
+  if (!p)
+    return nullptr;
+  *(size_t *)p = size;
+  liveBytes += size;
+  if (liveBytes > peakBytes)
+    peakBytes = liveBytes;
+  return p + HEADER;
+}
+
+void CountingAllocator::deallocate(void *ptr) {
+  if (!ptr)
+    return;
+  uint8_t *p = (uint8_t *)ptr - HEADER;
+  liveBytes -= *(size_t *)p;
+  free(p);
+}
+
+void *CountingAllocator::reallocate(void *ptr, size_t new_size) {
+  if (!ptr)
+    return allocate(new_size);
+  uint8_t *p = (uint8_t *)ptr - HEADER;
+  size_t old_size = *(size_t *)p;
+  uint8_t *np = (uint8_t *)realloc(p, new_size + HEADER);
+  if (!np)
+    return nullptr;
+  *(size_t *)np = new_size;
+  liveBytes = liveBytes - old_size + new_size;
+  if (liveBytes > peakBytes)
+    peakBytes = liveBytes;
+  return np + HEADER;
+}
+
+// --- NetStats ---
+
+const char *NetStats::name(NetEndpoint ep) {
+  switch (ep) {
+  case EP_OWM_GEO:
+    return "owm_geo";
+  case EP_OWM_FORECAST:
+    return "owm_forecast";
+  case EP_OWM_CURRENT:
+    return "owm_current";
+  case EP_OWM_AQI:
+    return "owm_aqi";
+  case EP_OPEN_METEO:
+    return "open_meteo";
+  case EP_TMB_PARADES:
+    return "tmb_parades";
+  case EP_YAHOO_SPARK:
+    return "yahoo_spark";
+  case EP_YAHOO_CHART:
+    return "yahoo_chart";
+  default:
+    return "unknown";
+  }
+}
+
+void NetStats::recordRequest(NetEndpoint ep, uint32_t ms, int status) {
+  if (ep >= EP_COUNT)
+    return;
+  Entry &e = entries[ep];
+  e.requests++;
+  if (status != 200)
+    e.errors++;
+  e.requestMs += ms;
+  if (ms > e.maxRequestMs)
+    e.maxRequestMs = ms;
+}
+
+void NetStats::recordDoc(NetEndpoint ep, size_t peakBytes) {
+  if (ep >= EP_COUNT)
+    return;
+  Entry &e = entries[ep];
+  e.docs++;
+  e.lastDocBytes = peakBytes;
+  if (peakBytes > e.maxDocBytes)
+    e.maxDocBytes = peakBytes;
+#if NET_TRACE
+  Serial.printf("JSON: %s doc %u B (max %u B, filters %s)\n", name(ep),
+                (unsigned)peakBytes, (unsigned)e.maxDocBytes,
+                JSON_FILTERS ? "on" : "off");
+#endif
+}
+
+void NetStats::recordStream(NetEndpoint ep, size_t bytes, uint32_t ms) {
+  if (ep >= EP_COUNT)
+    return;
+  Entry &e = entries[ep];
+  e.streamBytes += bytes;
+  e.streamMs += ms;
+  e.lastBytesPerSec = ms ? (uint32_t)((uint64_t)bytes * 1000 / ms) : 0;
+#if NET_TRACE
+  Serial.printf("NET: %s %u B in %u ms (%u B/s)\n", name(ep), (unsigned)bytes,
+                (unsigned)ms, (unsigned)e.lastBytesPerSec);
+#endif
+}
+
+void NetStats::finishFilter(JsonDocument &filter) {
+#if !JSON_FILTERS
+  filter.clear();
+  filter.set(true);
+#endif
+}
+
+void NetStats::reset() { memset(entries, 0, sizeof(entries)); }
+
+void NetStats::print() {
+  Serial.printf("NETSTATS: %-13s %5s %4s %7s %6s %6s %8s %8s %8s %8s\n",
+                "endpoint", "reqs", "errs", "avg ms", "max ms", "docs",
+                "last B", "max B", "last B/s", "avg B/s");
+  for (int i = 0; i < EP_COUNT; i++) {
+    const Entry &e = entries[i];
+    if (e.requests == 0 && e.docs == 0 && e.streamBytes == 0)
+      continue;
+    uint32_t avg =
+        e.streamMs ? (uint32_t)((uint64_t)e.streamBytes * 1000 / e.streamMs)
+                   : 0;
+    Serial.printf("NETSTATS: %-13s %5u %4u %7u %6u %6u %8u %8u %8u %8u\n",
+                  name((NetEndpoint)i), (unsigned)e.requests,
+                  (unsigned)e.errors,
+                  (unsigned)(e.requests ? e.requestMs / e.requests : 0),
+                  (unsigned)e.maxRequestMs, (unsigned)e.docs,
+                  (unsigned)e.lastDocBytes, (unsigned)e.maxDocBytes,
+                  (unsigned)e.lastBytesPerSec, (unsigned)avg);
+  }
+}
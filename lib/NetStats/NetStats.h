@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Build with -D JSON_FILTERS=0 to parse full documents (baseline for the
+// per-endpoint peak document size report)
+#ifndef JSON_FILTERS
+#define JSON_FILTERS 1
+#endif
+
+// Build with -D NET_TRACE=1 to log every parse and response as it happens;
+// otherwise the counters are only shown by print()
+#ifndef NET_TRACE
+#define NET_TRACE 0
+#endif
+
+// Every upstream endpoint the services talk to
+enum NetEndpoint : uint8_t {
+  EP_OWM_GEO,
+  EP_OWM_FORECAST,
+  EP_OWM_CURRENT,
+  EP_OWM_AQI,
+  EP_OPEN_METEO,
+  EP_TMB_PARADES,
+  EP_YAHOO_SPARK,
+  EP_YAHOO_CHART,
+  EP_COUNT
+};
+
+// ArduinoJson allocator that tracks live and peak bytes of one document.
+// Usage: CountingAllocator alloc; JsonDocument doc(&alloc);
+class CountingAllocator : public ArduinoJson::Allocator {
+public:
+  void *allocate(size_t size) override;
+  void deallocate(void *ptr) override;
+  void *reallocate(void *ptr, size_t new_size) override;
+
+  size_t peak() const { return peakBytes; }
+
+private:
+  static const size_t HEADER = 8; // Keeps 8-byte alignment for doubles
+  size_t liveBytes = 0;
+  size_t peakBytes = 0;
+};
+
+// Per-endpoint network/parse statistics (written by the network task)
+class NetStats {
+public:
+  struct Entry {
+    uint32_t requests; // Requests handed back to HttpPool::release()
+    uint32_t errors;   // ...that did not end in HTTP 200
+    uint32_t requestMs; // Totals over all requests: begin() to release()
+    uint32_t maxRequestMs;
+    uint32_t docs;
+    size_t lastDocBytes;
+    size_t maxDocBytes;
+    uint32_t streamBytes; // Totals over all responses
+    uint32_t streamMs;
+    uint32_t lastBytesPerSec;
+  };
+
+  static const char *name(NetEndpoint ep);
+
+  // Whole request time and its HTTP status (<= 0: no response)
+  static void recordRequest(NetEndpoint ep, uint32_t ms, int status);
+
+  // Peak heap bytes held by one parsed JsonDocument
+  static void recordDoc(NetEndpoint ep, size_t peakBytes);
+
+  // Body bytes consumed by the parser and the time it took (bytes/s)
+  static void recordStream(NetEndpoint ep, size_t bytes, uint32_t ms);
+
+  // Turns a filter spec into "keep everything" when JSON_FILTERS=0
+  static void finishFilter(JsonDocument &filter);
+
+  static const Entry &get(NetEndpoint ep) { return entries[ep]; }
+  static void reset(); // Benchmarks: start a new measurement window
+  static void print();
+
+private:
+  static Entry entries[EP_COUNT];
+};
@@ -1,4 +1,6 @@
 #include "NetworkManager.h"
+#include "BusService.h"
+#include "WeatherService.h"
 #include <WiFiManager.h>
 
 Preferences NetworkManager::prefs;
@@ -35,8 +37,8 @@ std::vector<String> NetworkManager::getBusStops() {
     if (s.length() > 0)
       stops.push_back(s);
     start = comma + 1;
-    if (stops.size() >= 5)
-      break; // Limit to 5 stops
+    if (stops.size() >= BUS_MAX_STOPS)
+      break;
   }
   if (stops.empty())
     stops.push_back("2156"); // Default
@@ -214,6 +216,10 @@ void NetworkManager::handleRoot() {
 
 void NetworkManager::handleSave() {
   if (server.hasArg("city") && server.hasArg("busStop")) {
+    // Coordinates are cached per city name; drop them if the list changed
+    if (server.arg("city") != city)
+      WeatherService::clearGeoCache();
+
     city = server.arg("city");
     busStop = server.arg("busStop");
     appId = server.arg("appId");
@@ -280,9 +286,10 @@ void NetworkManager::configModeCallback(WiFiManager *myWiFiManager) {
   Serial.println(buf);
 }
 
-void NetworkManager::begin() {
-  Serial.println("NETWORK: Begin...");
-  prefs.begin("weather_cfg", false);
+// NVS config only (no WiFi), so cached screens can be set up before
+// autoConnect blocks. begin() calls it again; reloading is cheap.
+void NetworkManager::loadConfig() {
+  prefs.begin("weather_cfg", true);
   city = prefs.getString("city", "Barcelona");
   busStop = prefs.getString("busStop", "2156");
   appId = prefs.getString("app_id", "");
@@ -303,6 +310,17 @@ void NetworkManager::begin() {
 
   // Custom Keys
   owmApiKey = prefs.getString("owmApiKey", "");
+  prefs.end();
+
+  // Local time for cached forecasts, before NTP has synced
+  setenv("TZ", timezone.c_str(), 1);
+  tzset();
+}
+
+void NetworkManager::begin() {
+  Serial.println("NETWORK: Begin...");
+  loadConfig();
+  prefs.begin("weather_cfg", false);
 
   WiFiManager wm;
   wm.setSaveConfigCallback(saveConfigCallback);
@@ -341,6 +359,8 @@ void NetworkManager::begin() {
 
   if (shouldSaveConfig) {
     Serial.println("NETWORK: Saving New Config...");
+    if (city != custom_city.getValue())
+      WeatherService::clearGeoCache();
     city = custom_city.getValue();
     busStop = custom_busStop.getValue();
     appId = custom_appId.getValue();
@@ -359,6 +379,14 @@ void NetworkManager::begin() {
   }
   prefs.end();
 
+  // DataManager set up its cities and stops from NVS before autoConnect:
+  // restart so it picks up the portal's, like handleSave does
+  if (shouldSaveConfig) {
+    Serial.println("NETWORK: Restarting with the new config...");
+    delay(1000);
+    ESP.restart();
+  }
+
   // Start Web Server
   server.on("/", handleRoot);
   server.on("/save", HTTP_POST, handleSave);
@@ -9,7 +9,8 @@ extern SemaphoreHandle_t dataMutex;
 
 class NetworkManager {
 public:
-  static void begin();
+  static void begin();      // loadConfig() + WiFi, NTP and web server
+  static void loadConfig(); // NVS settings only (safe before WiFi)
   static void reset();
 
   static void handleClient(); // New: Handle web requests
@@ -1,11 +1,16 @@
 #include "StockService.h"
+#include "HttpPool.h"
+#include "NetStats.h"
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 
+String StockService::baseUrl;
+
 std::vector<StockItem> StockService::getQuotes(String symbols) {
   std::vector<StockItem> items;
 
   // Symbols are comma separated: "AAPL,MSFT,BTC-USD,GRF.MC"
+  std::vector<String> list;
   int startIndex = 0;
   while (startIndex < symbols.length()) {
     int commaIndex = symbols.indexOf(',', startIndex);
@@ -16,77 +21,227 @@ std::vector<StockItem> StockService::getQuotes(String symbols) {
     symbol.trim();
     startIndex = commaIndex + 1;
 
-    if (symbol.isEmpty())
-      continue;
-
-    // Fetch
-    if (WiFi.status() == WL_CONNECTED) {
-      HTTPClient http;
-      // Yahoo Finance Query
-      // https://query1.finance.yahoo.com/v8/finance/chart/AAPL?interval=1d&range=1d
-      String url = "https://query1.finance.yahoo.com/v8/finance/chart/" +
-                   symbol + "?interval=1d&range=1d";
-
-      // Serial.printf("STOCK: Fetching %s\n", symbol.c_str());
-
-      http.begin(url);
-      http.setUserAgent("Mozilla/5.0 (esp32)"); // Yahoo blocks generic agents
-      int httpCode = http.GET();
-
-      if (httpCode > 0) {
-        // Correctly handle HTTP 200 OK
-        if (httpCode == HTTP_CODE_OK) {
-          JsonDocument doc;
-          // Filter data to save memory (Yahoo JSON is huge)
-          JsonDocument filter;
-          filter["chart"]["result"][0]["meta"] = true; // Capture all meta data
-
-          // STREAM PARSING: Read directly from socket (Low RAM usage)
-          DeserializationError error = deserializeJson(
-              doc, http.getStream(), DeserializationOption::Filter(filter));
-
-          if (!error) {
-            JsonObject meta = doc["chart"]["result"][0]["meta"];
-            float price = meta["regularMarketPrice"];
-            float prevClose = meta["previousClose"];
-
-            // Fallback for some assets
-            if (prevClose == 0.0f)
-              prevClose = meta["chartPreviousClose"];
-
-            if (price != 0.0f) {
-              StockItem item;
-              item.symbol = symbol;
-              item.price = price;
-              // Calculate Change %
-              if (prevClose != 0.0f) {
-                item.changePercent = ((price - prevClose) / prevClose) * 100.0f;
-              } else {
-                item.changePercent = 0.0f;
-              }
-
-              item.isValid = true;
-              items.push_back(item);
-              Serial.printf("STOCK: Parsed %s -> $%.2f (%.2f%%)\n",
-                            symbol.c_str(), price, item.changePercent);
-            } else {
-              Serial.printf("STOCK: Invalid data for %s (Zero Price)\n",
-                            symbol.c_str());
-            }
-          } else {
-            Serial.printf("STOCK: JSON Error for %s: %s\n", symbol.c_str(),
-                          error.c_str());
-          }
-        } else {
-          Serial.printf("STOCK: HTTP Error for %s: %d\n", symbol.c_str(),
-                        httpCode);
-        }
-      } else {
-        Serial.printf("STOCK: Connection Failed for %s\n", symbol.c_str());
+    if (!symbol.isEmpty())
+      list.push_back(symbol);
+  }
+
+  if (list.empty() || WiFi.status() != WL_CONNECTED)
+    return items;
+
+  // 1. Batched fetch (one request per BATCH_SIZE symbols)
+  // Slots keep the configured order; isValid marks filled entries
+  items.resize(list.size());
+  for (size_t i = 0; i < list.size(); i++) {
+    items[i].symbol = list[i];
+    items[i].isValid = false;
+  }
+  for (size_t start = 0; start < list.size(); start += BATCH_SIZE) {
+    size_t count = list.size() - start;
+    if (count > BATCH_SIZE)
+      count = BATCH_SIZE;
+    if (!fetchBatch(list, start, count, items))
+      Serial.printf("STOCK: Batch %u failed, falling back per symbol\n",
+                    (unsigned)(start / BATCH_SIZE));
+  }
+
+  // 2. Per-symbol fallback for anything the batch did not deliver
+  for (size_t i = 0; i < items.size(); i++) {
+    if (!items[i].isValid)
+      fetchSingle(list[i], items[i]);
+  }
+
+  // Drop symbols that failed both paths
+  std::vector<StockItem> valid;
+  valid.reserve(items.size());
+  for (const auto &item : items) {
+    if (item.isValid)
+      valid.push_back(item);
+  }
+  return valid;
+}
+
+bool StockService::makeItem(const String &symbol, float price,
+                            float prevClose, StockItem &item) {
+  if (price == 0.0f) {
+    Serial.printf("STOCK: Invalid data for %s (Zero Price)\n", symbol.c_str());
+    return false;
+  }
+
+  item.symbol = symbol;
+  item.price = price;
+  // Calculate Change %
+  if (prevClose != 0.0f) {
+    item.changePercent = ((price - prevClose) / prevClose) * 100.0f;
+  } else {
+    item.changePercent = 0.0f;
+  }
+  item.isValid = true;
+  Serial.printf("STOCK: Parsed %s -> $%.2f (%.2f%%)\n", symbol.c_str(), price,
+                item.changePercent);
+  return true;
+}
+
+bool StockService::fetchBatch(const std::vector<String> &symbols,
+                              size_t start, size_t count,
+                              std::vector<StockItem> &items) {
+  // Yahoo Finance Spark (multi-symbol)
+  // https://query1.finance.yahoo.com/v8/finance/spark?symbols=AAPL,MSFT&range=1d&interval=1d
+  String url = api() + "/v8/finance/spark?symbols=";
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0)
+      url += ",";
+    url += symbols[start + i];
+  }
+  url += "&range=1d&interval=1d";
+
+  HTTPClient *pooled = HttpPool::begin(url, EP_YAHOO_SPARK, 8000);
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
+  http.setUserAgent("Mozilla/5.0 (esp32)"); // Yahoo blocks generic agents
+
+  int httpCode = HttpPool::get(&http);
+  if (httpCode != HTTP_CODE_OK) {
+    Serial.printf("STOCK: Batch HTTP Error: %d\n", httpCode);
+    HttpPool::release(&http);
+    return false;
+  }
+
+  // STREAM PARSING. Spark answers in one of two shapes:
+  //   {"spark":{"result":[{"symbol":..,"response":[{"meta":{..}}]},..]}}
+  //   {"AAPL":{"symbol":..,"close":[..],"previousClose":..},..}
+  // Either way each symbol's block is deserialized on its own, so only one
+  // is ever held in RAM regardless of watchlist length. Anything else
+  // parses nothing and getQuotes() falls back to /chart per symbol.
+  JsonDocument filter;
+  filter["symbol"] = true;
+  JsonObject meta = filter["response"][0]["meta"].to<JsonObject>();
+  meta["regularMarketPrice"] = true;
+  meta["previousClose"] = true;
+  meta["chartPreviousClose"] = true;
+  filter["close"] = true;
+  filter["previousClose"] = true;
+  filter["chartPreviousClose"] = true;
+  NetStats::finishFilter(filter);
+
+  Stream &stream = HttpPool::stream(&http);
+  int parsed = 0;
+  // The first key tells the shapes apart ("finance" is Yahoo's error body)
+  String key;
+  if (stream.find("\""))
+    key = stream.readStringUntil('"');
+  bool keyed = !key.isEmpty() && key != "spark" && key != "finance";
+  bool more = keyed ? stream.find(":") : stream.find("\"result\":[");
+  while (more) {
+    CountingAllocator alloc;
+    JsonDocument doc(&alloc);
+    DeserializationError error = deserializeJson(
+        doc, stream, DeserializationOption::Filter(filter));
+    NetStats::recordDoc(EP_YAHOO_SPARK, alloc.peak());
+    if (error) {
+      Serial.printf("STOCK: Batch JSON Error: %s\n", error.c_str());
+      break;
+    }
+
+    String symbol = doc["symbol"] | (keyed ? key.c_str() : "");
+    float price, prevClose;
+    JsonObject m = doc["response"][0]["meta"];
+    if (m) {
+      price = m["regularMarketPrice"];
+      prevClose = m["previousClose"];
+      if (prevClose == 0.0f) // Fallback for some assets
+        prevClose = m["chartPreviousClose"];
+    } else {
+      // Keyed shape: no meta, the price is the last close
+      price = 0.0f;
+      for (JsonVariant c : doc["close"].as<JsonArray>()) {
+        if (!c.isNull())
+          price = c.as<float>();
+      }
+      prevClose = doc["previousClose"];
+      if (prevClose == 0.0f)
+        prevClose = doc["chartPreviousClose"];
+    }
+
+    for (size_t i = start; i < start + count; i++) {
+      if (!items[i].isValid && symbol.equalsIgnoreCase(symbols[i])) {
+        if (makeItem(symbols[i], price, prevClose, items[i]))
+          parsed++;
+        break;
+      }
+    }
+
+    if (!keyed) {
+      more = stream.findUntil(",", "]");
+    } else {
+      more = stream.findUntil(",", "}") && stream.find("\"");
+      if (more) {
+        key = stream.readStringUntil('"');
+        more = stream.find(":");
       }
-      http.end();
     }
   }
 
-  return items;
+  HttpPool::release(&http);
+  return parsed > 0;
+}
+
+bool StockService::fetchSingle(const String &symbol, StockItem &item) {
+  // Yahoo Finance Query
+  // https://query1.finance.yahoo.com/v8/finance/chart/AAPL?interval=1d&range=1d
+  String url = api() + "/v8/finance/chart/" + symbol + "?interval=1d&range=1d";
+
+  // Serial.printf("STOCK: Fetching %s\n", symbol.c_str());
+
+  HTTPClient *pooled = HttpPool::begin(url, EP_YAHOO_CHART);
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
+  http.setUserAgent("Mozilla/5.0 (esp32)"); // Yahoo blocks generic agents
+  int httpCode = HttpPool::get(&http);
+
+  bool ok = false;
+  if (httpCode > 0) {
+    // Correctly handle HTTP 200 OK
+    if (httpCode == HTTP_CODE_OK) {
+      CountingAllocator alloc;
+      JsonDocument doc(&alloc);
+      // Filter data to save memory (Yahoo JSON is huge)
+      JsonDocument filter;
+      JsonObject metaFilter =
+          filter["chart"]["result"][0]["meta"].to<JsonObject>();
+      metaFilter["regularMarketPrice"] = true;
+      metaFilter["previousClose"] = true;
+      metaFilter["chartPreviousClose"] = true;
+      NetStats::finishFilter(filter);
+
+      // STREAM PARSING: Read directly from socket (Low RAM usage)
+      DeserializationError error =
+          deserializeJson(doc, HttpPool::stream(&http),
+                          DeserializationOption::Filter(filter));
+      NetStats::recordDoc(EP_YAHOO_CHART, alloc.peak());
+
+      if (!error) {
+        JsonObject meta = doc["chart"]["result"][0]["meta"];
+        float price = meta["regularMarketPrice"];
+        float prevClose = meta["previousClose"];
+
+        // Fallback for some assets
+        if (prevClose == 0.0f)
+          prevClose = meta["chartPreviousClose"];
+
+        ok = makeItem(symbol, price, prevClose, item);
+      } else {
+        Serial.printf("STOCK: JSON Error for %s: %s\n", symbol.c_str(),
+                      error.c_str());
+      }
+    } else {
+      Serial.printf("STOCK: HTTP Error for %s: %d\n", symbol.c_str(),
+                    httpCode);
+    }
+  } else {
+    Serial.printf("STOCK: Connection Failed for %s\n", symbol.c_str());
+  }
+  HttpPool::release(&http);
+  return ok;
 }
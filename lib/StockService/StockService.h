@@ -14,6 +14,25 @@ struct StockItem {
 class StockService {
 public:
   static std::vector<StockItem> getQuotes(String symbols);
+
+  // Yahoo origin override for tools/replay_server.py (empty: real API)
+  static void setBaseUrl(const String &url) { baseUrl = url; }
+
+private:
+  static String baseUrl;
+  static String api() {
+    return baseUrl.isEmpty() ? String("https://query1.finance.yahoo.com")
+                             : baseUrl;
+  }
+
+  // Yahoo spark accepts up to 20 symbols per request
+  static const size_t BATCH_SIZE = 20;
+
+  static bool fetchBatch(const std::vector<String> &symbols, size_t start,
+                         size_t count, std::vector<StockItem> &items);
+  static bool fetchSingle(const String &symbol, StockItem &item);
+  static bool makeItem(const String &symbol, float price, float prevClose,
+                       StockItem &item);
 };
 
 #endif
@@ -1,14 +1,28 @@
 #include "TouchDrv.h"
 
+volatile bool TouchDrv::irqPending = false;
+volatile bool TouchDrv::touchActive = false;
+volatile uint32_t TouchDrv::irqCount = 0;
+void (*TouchDrv::wakeCb)() = NULL;
+
 TouchDrv::TouchDrv() {}
 
+void IRAM_ATTR TouchDrv::isr() {
+  irqPending = true;
+  irqCount++;
+  if (wakeCb && !touchActive)
+    wakeCb(); // New touch: don't wait for the next indev period
+}
+
+void TouchDrv::setWakeCallback(void (*cb)()) { wakeCb = cb; }
+
 void TouchDrv::begin() {
   Wire.begin(_sda, _scl);
   Wire.setClock(400000); // 400kHz for fast touch response
   Wire.setTimeOut(20);   // 20ms timeout to prevent blocking loop
 
-  // Int Pin Configuration
-  pinMode(_int, INPUT); // Just input
+  // Int Pin Configuration (active low pulses)
+  pinMode(_int, INPUT_PULLUP);
 
   // Reset Pin Configuration
   Serial.println("TOUCH: Performing Reset Sequence...");
@@ -40,7 +54,7 @@ void TouchDrv::begin() {
 
   Wire.beginTransmission(I2C_ADDR_CST820);
   Wire.write(0xFA);
-  Wire.write(0x60); // Threshold?
+  Wire.write(0x70); // IrqCtl: EnTouch | EnChange | EnMotion (gestures)
   Wire.endTransmission();
   delay(20);
 
@@ -55,49 +69,100 @@ void TouchDrv::begin() {
 
   uint8_t id2 = i2c_read(0x15);
   Serial.printf("TOUCH: Read Alt ID (0x15): 0x%02X\n", id2);
+
+  attachInterrupt(digitalPinToInterrupt(_int), isr, FALLING);
+  statsMs = millis();
 }
 
-bool TouchDrv::read(int16_t *x, int16_t *y) {
-  uint8_t fingerNum = i2c_read(0x02);
-
-  // Debug I2C status every ~100 calls to avoid spam, OR if finger detected
-  static int debug_cnt = 0;
-  if (fingerNum > 0 || debug_cnt++ > 500) {
-    if (debug_cnt > 500)
-      debug_cnt = 0;
-    // Serial.printf("TOUCH: Reg 0x02 (FingerNum) = %d\n", fingerNum);
+void TouchDrv::printStats() {
+  uint32_t now = millis();
+  uint32_t ms = now - statsMs;
+  if (ms == 0)
+    return;
+  uint32_t irqs = irqCount;
+  Serial.printf("TOUCH: %u I2C tx/s, %u INT/s over %u ms\n",
+                (unsigned)((txCount - statsTx) * 1000UL / ms),
+                (unsigned)((irqs - statsIrq) * 1000UL / ms), (unsigned)ms);
+  statsTx = txCount;
+  statsIrq = irqs;
+  statsMs = now;
+}
+
+TouchGesture TouchDrv::decodeGesture(uint8_t id) {
+  switch (id) {
+  case 0x01:
+    return GESTURE_SWIPE_UP;
+  case 0x02:
+    return GESTURE_SWIPE_DOWN;
+  case 0x03:
+    return GESTURE_SWIPE_LEFT;
+  case 0x04:
+    return GESTURE_SWIPE_RIGHT;
+  case 0x05:
+    return GESTURE_TAP;
+  case 0x0C:
+    return GESTURE_LONG_PRESS;
+  default:
+    return GESTURE_NONE; // 0x00 none, 0x0B double click (not used)
   }
+}
+
+const char *TouchDrv::gestureName(TouchGesture g) {
+  static const char *names[] = {"none",  "up",  "down",      "left",
+                                "right", "tap", "long press"};
+  return names[g];
+}
 
-  // Always read coordinates for debug
-  uint8_t data[4];
-  i2c_read_continuous(0x03, data, 4);
+TouchGesture TouchDrv::takeGesture() {
+  TouchGesture g = pendingGesture;
+  pendingGesture = GESTURE_NONE;
+  return g;
+}
 
-  uint16_t _x = ((data[0] & 0x0f) << 8) | data[1];
-  uint16_t _y = ((data[2] & 0x0f) << 8) | data[3];
+bool TouchDrv::read(int16_t *x, int16_t *y) {
+  // No edge, no finger down: nothing can have changed
+  uint32_t now = millis();
+  if (!irqPending && !touchActive && now - lastPoll < TOUCH_IDLE_POLL_MS)
+    return false;
+  irqPending = false;
+  lastPoll = now;
 
-  // Return if no finger
-  if (fingerNum == 0) {
-    // Serial.print("."); // Alive tick
+  // One burst: 0x01 GestureID, 0x02 FingerNum, 0x03-0x06 X/Y high/low
+  uint8_t data[6];
+  if (i2c_read_continuous(0x01, data, 6) != 0) {
+    touchActive = false;
     return false;
   }
+  uint8_t fingerNum = data[1];
   if (fingerNum == 255) {
     Serial.print("!"); // I2C Fail
+    touchActive = false;
     return false;
   }
 
-  // Serial.printf("TOUCH RAW: num=%d, raw_x=%d, raw_y=%d\n", fingerNum, _x,
-  // _y);
+  // Gesture: at most one per touch. The register can still hold the
+  // previous touch's gesture on the touch-down frame, so that one is skipped.
+  bool down = fingerNum > 0;
+  if (down && !touchActive) {
+    gestureTaken = false;
+  } else if (!gestureTaken) {
+    TouchGesture g = decodeGesture(data[0]);
+    if (g != GESTURE_NONE) {
+      pendingGesture = g;
+      gestureTaken = true;
+    }
+  }
 
-  // Invert/Map logic for 240x320
-  // User reported reverse scroll. Adjusting mapping.
-  // Try passing raw Y (or inverted X depending on orientation)
-  // Assuming portrait:
-  // Debug: Print raw and mapped coordinates
-  // Serial.printf("TOUCH DEBUG: Raw X=%d Y=%d -> Mapped X=%d Y=%d\n", _x, _y,
-  // _x, _y); Just print mapped for now to see what LVGL gets
+  // Return if no finger
+  if (!down) {
+    touchActive = false;
+    return false;
+  }
 
-  *x = _x;
-  *y = _y;
+  // Raw coordinates already match the 240x320 portrait orientation
+  *x = ((data[2] & 0x0f) << 8) | data[3];
+  *y = ((data[4] & 0x0f) << 8) | data[5];
+  touchActive = true; // Keep reading each period until the release
 
   return true;
 }
@@ -111,6 +176,7 @@ uint8_t TouchDrv::i2c_read(uint8_t addr) {
     Wire.write(addr);
     Wire.endTransmission(false); // Restart
     rdDataCount = Wire.requestFrom(I2C_ADDR_CST820, 1);
+    txCount++;
     if (rdDataCount == 0)
       delay(1);
     retries--;
@@ -126,11 +192,12 @@ uint8_t TouchDrv::i2c_read_continuous(uint8_t addr, uint8_t *data,
                                       uint32_t length) {
   Wire.beginTransmission(I2C_ADDR_CST820);
   Wire.write(addr);
-  if (Wire.endTransmission(true))
-    return -1;
-
-  Wire.requestFrom(I2C_ADDR_CST820, (size_t)length);
-  for (int i = 0; i < length; i++) {
+  Wire.endTransmission(false); // Restart
+  size_t got = Wire.requestFrom(I2C_ADDR_CST820, (size_t)length);
+  txCount++;
+  if (got != length)
+    return 1;
+  for (uint32_t i = 0; i < length; i++) {
     *data++ = Wire.read();
   }
   return 0;
@@ -141,4 +208,5 @@ void TouchDrv::i2c_write(uint8_t addr, uint8_t data) {
   Wire.write(addr);
   Wire.write(data);
   Wire.endTransmission();
+  txCount++;
 }
@@ -6,13 +6,55 @@
 
 #define I2C_ADDR_CST820 0x15
 
+// Gestures decoded by the controller (register 0x01)
+enum TouchGesture {
+  GESTURE_NONE = 0,
+  GESTURE_SWIPE_UP,
+  GESTURE_SWIPE_DOWN,
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT,
+  GESTURE_TAP,
+  GESTURE_LONG_PRESS
+};
+
+// Safety poll while idle, in case an INT edge is ever missed
+#define TOUCH_IDLE_POLL_MS 1000
+
+// Interrupt-driven: the controller pulses INT low while touched and on
+// change, so read() only talks I2C after an edge or while a finger is down;
+// otherwise it returns the cached released state.
 class TouchDrv {
 public:
   TouchDrv();
   void begin();
   bool read(int16_t *x, int16_t *y);
 
+  // Next hardware gesture (one per touch), GESTURE_NONE if there is none
+  TouchGesture takeGesture();
+  static const char *gestureName(TouchGesture g);
+
+  // Called from the ISR on the first edge of a touch (must be IRAM safe)
+  void setWakeCallback(void (*cb)());
+  // I2C transactions/s and INT edges/s since the previous call
+  void printStats();
+
 private:
+  static void IRAM_ATTR isr();
+  static volatile bool irqPending;
+  static volatile bool touchActive; // Finger down as of the last read
+  static volatile uint32_t irqCount;
+  static void (*wakeCb)();
+
+  static TouchGesture decodeGesture(uint8_t id);
+
+  TouchGesture pendingGesture = GESTURE_NONE;
+  bool gestureTaken = false; // Already reported for the current touch
+  uint32_t lastPoll = 0;
+  uint32_t txCount = 0; // I2C transactions
+  uint32_t statsTx = 0;
+  uint32_t statsIrq = 0;
+  uint32_t statsMs = 0;
+
   uint8_t i2c_read(uint8_t addr);
   uint8_t i2c_read_continuous(uint8_t addr, uint8_t *data, uint32_t length);
   void i2c_write(uint8_t addr, uint8_t data);
@@ -0,0 +1,131 @@
+#include "Translit.h"
+#include <string.h>
+
+// U+0080..U+00FF (lead bytes 0xC2/0xC3), indexed by code point - 0x80.
+// 0 = no ASCII equivalent, copy the sequence through.
+static const char latin1[128] = {
+    // U+0080..U+009F: C1 controls
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+    // U+00A0..U+00BF: NBSP ¡ ¢ £ ¤ ¥ ¦ § ¨ © ª « ¬ SHY ® ¯
+    //                 ° ± ² ³ ´ µ ¶ · ¸ ¹ º » ¼ ½ ¾ ¿
+    ' ', '!', 0, 0, 0, 0, '|', 0, 0, 0, 'a', '"', 0, '-', 0, 0, //
+    0, 0, '2', '3', '\'', 'u', 0, '.', 0, '1', 'o', '"', 0, 0, 0, '?', //
+    // U+00C0..U+00DF: À Á Â Ã Ä Å Æ Ç È É Ê Ë Ì Í Î Ï
+    //                 Ð Ñ Ò Ó Ô Õ Ö × Ø Ù Ú Û Ü Ý Þ ß
+    'A', 'A', 'A', 'A', 'A', 'A', 'A', 'C', 'E', 'E', 'E', 'E', 'I', 'I', 'I',
+    'I', //
+    'D', 'N', 'O', 'O', 'O', 'O', 'O', 'x', 'O', 'U', 'U', 'U', 'U', 'Y', 0,
+    's', //
+    // U+00E0..U+00FF: à á â ã ä å æ ç è é ê ë ì í î ï
+    //                 ð ñ ò ó ô õ ö ÷ ø ù ú û ü ý þ ÿ
+    'a', 'a', 'a', 'a', 'a', 'a', 'a', 'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i',
+    'i', //
+    'd', 'n', 'o', 'o', 'o', 'o', 'o', 0, 'o', 'u', 'u', 'u', 'u', 'y', 0,
+    'y', //
+};
+
+// U+2000..U+203F (lead 0xE2 0x80): spaces, dashes, quotes, ellipsis
+static const char punct[64] = {
+    ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', 0, 0, 0, 0, 0, //
+    '-', '-', '-', '-', '-', '-', 0, 0, '\'', '\'', '\'', '\'', '"', '"', '"',
+    '"', //
+    0, 0, '.', 0, '.', 0, '.', '.', 0, 0, 0, 0, 0, 0, 0, ' ', //
+    0, 0, '\'', '"', 0, 0, 0, 0, 0, '<', '>', 0, 0, 0, 0, 0, //
+};
+
+// Non-ASCII glyphs in the name fonts, U+0080..U+00FF as a bitmap. Must match
+// NAME_SYMBOLS in tools/font_subset.py: À Á Ç È É Í Ï Ñ Ò Ó Ú Ü, the same in
+// lower case, and the Catalan middle dot.
+static const uint32_t nameGlyphs[4] = {0x00000000, 0x00800000, 0x140EA383,
+                                       0x140EA383};
+
+bool Translit::hasNameGlyph(uint32_t cp) {
+  if (cp >= 0x20 && cp <= 0x7E)
+    return true;
+#ifndef NAME_FONTS
+  return false; // Labels on built-in Montserrat: ASCII only
+#endif
+  if (cp < 0x80 || cp > 0xFF)
+    return false;
+  cp -= 0x80;
+  return (nameGlyphs[cp >> 5] >> (cp & 31)) & 1;
+}
+
+size_t Translit::forDisplay(const char *in, char *out, size_t outSize) {
+  if (outSize == 0)
+    return 0;
+  // Coverage pass: only 2-byte sequences can be in the font
+  const uint8_t *p = (const uint8_t *)in;
+  size_t len = 0;
+  while (*p) {
+    uint32_t cp = *p;
+    if (cp >= 0x80) {
+      if ((cp & 0xE0) != 0xC0 || (p[1] & 0xC0) != 0x80)
+        return apply(in, out, outSize);
+      cp = ((cp & 0x1F) << 6) | (p[1] & 0x3F);
+      p++;
+      len++;
+    }
+    if (!hasNameGlyph(cp))
+      return apply(in, out, outSize);
+    p++;
+    len++;
+  }
+
+  // Covered: copy as is, without splitting a sequence at the buffer end
+  if (len >= outSize) {
+    len = outSize - 1;
+    while (len > 0 && ((uint8_t)in[len] & 0xC0) == 0x80)
+      len--;
+  }
+  memcpy(out, in, len);
+  out[len] = '\0';
+  return len;
+}
+
+size_t Translit::apply(const char *in, char *out, size_t outSize) {
+  if (outSize == 0)
+    return 0;
+  const uint8_t *p = (const uint8_t *)in;
+  size_t n = 0, cap = outSize - 1;
+
+  while (*p && n < cap) {
+    uint8_t c = *p;
+    if (c < 0x80) { // ASCII fast path
+      out[n++] = (char)c;
+      p++;
+      continue;
+    }
+
+    // Sequence length from the lead byte; stop at a truncated sequence
+    size_t len = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+    size_t i = 1;
+    while (i < len && (p[i] & 0xC0) == 0x80)
+      i++;
+    if (i < len) { // Malformed: drop the lead byte
+      p++;
+      continue;
+    }
+
+    char mapped = 0;
+    if (len == 2 && (c == 0xC2 || c == 0xC3))
+      mapped = latin1[((c & 0x01) << 6) | (p[1] & 0x3F)];
+    else if (len == 3 && c == 0xE2 && p[1] == 0x80)
+      mapped = punct[p[2] & 0x3F];
+
+    if (mapped) {
+      out[n++] = mapped;
+    } else if (len == 1) {
+      // Stray continuation byte: drop
+    } else {
+      if (n + len > cap)
+        break; // Never emit half a sequence
+      for (size_t k = 0; k < len; k++)
+        out[n++] = (char)p[k];
+    }
+    p += len;
+  }
+  out[n] = '\0';
+  return n;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+// Single-pass UTF-8 -> display ASCII transliteration (à -> a, Ç -> C,
+// l·l -> l.l, curly quotes -> straight, ...). Walks the input once with
+// compile-time lookup tables and writes into a caller buffer; sequences
+// without a mapping are copied through unchanged. Apply it once when data
+// is ingested, not on every render.
+// The core works on plain char buffers so tools/translit_bench.cpp can
+// reuse it; the String helpers below exist only in Arduino builds.
+class Translit {
+public:
+  // Writes at most outSize - 1 bytes plus a NUL and never splits a UTF-8
+  // sequence. Returns the output length.
+  static size_t apply(const char *in, char *out, size_t outSize);
+
+  // Glyph-coverage pass for the name fonts (font_names_*, generated by
+  // tools/font_subset.py, used when built with NAME_FONTS): keeps the UTF-8
+  // text intact when every codepoint has a glyph there, otherwise falls back
+  // to apply(). Without NAME_FONTS the labels are ASCII, so it always folds.
+  static size_t forDisplay(const char *in, char *out, size_t outSize);
+  static bool hasNameGlyph(uint32_t cp);
+
+#ifdef ARDUINO
+  // Ingest helper for String fields (stop/destination/city names)
+  static String forDisplay(const String &in) {
+    char buf[128];
+    forDisplay(in.c_str(), buf, sizeof(buf));
+    return String(buf);
+  }
+#endif
+};
@@ -0,0 +1,105 @@
+#include "ForecastAggregator.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int twoDigits(const char *p) { return (p[0] - '0') * 10 + (p[1] - '0'); }
+
+int ForecastAggregator::iconToWmo(const char *icon) {
+  if (!icon || !icon[0] || !icon[1])
+    return 3; // Default Overcast
+  switch (twoDigits(icon)) {
+  case 1:
+    return 0; // Clear
+  case 2:
+    return 1; // Few Clouds
+  case 3:
+    return 2; // Scattered
+  case 4:
+    return 3; // Broken
+  case 9:
+    return 80; // Shower Rain
+  case 10:
+    return 61; // Rain
+  case 11:
+    return 95; // Thunder
+  case 13:
+    return 71; // Snow
+  case 50:
+    return 45; // Mist
+  default:
+    return 3;
+  }
+}
+
+void ForecastAggregator::reset() {
+  hourCount = 0;
+  dayCount = 0;
+  curDate[0] = '\0';
+  dayMin = 100;
+  dayMax = -100;
+  dayPopMax = 0;
+  middayCode = 3;
+  middayDiff = 9999;
+}
+
+void ForecastAggregator::commitDay() {
+  if (curDate[0] == '\0' || dayCount >= MAX_DAYS)
+    return;
+  Day &d = days[dayCount++];
+  d.year = atoi(curDate);
+  d.month = twoDigits(curDate + 5);
+  d.day = twoDigits(curDate + 8);
+  d.date = d.year * 10000 + d.month * 100 + d.day;
+  d.minTemp = dayMin;
+  d.maxTemp = dayMax;
+  d.pop = dayPopMax;
+  d.weatherCode = middayCode;
+}
+
+void ForecastAggregator::add(const ForecastItem &item) {
+  const char *dt = item.dtTxt;
+  if (!dt || strlen(dt) < 16)
+    return;
+  int wmo = iconToWmo(item.icon);
+
+  // 1. Hourly (actually 3-hour steps): first 24 items = 72h coverage
+  if (hourCount < MAX_HOURS) {
+    Hour &h = hours[hourCount++];
+    h.time = item.dt;
+    h.temp = item.temp;
+    h.pop = item.pop;
+    h.weatherCode = wmo;
+  }
+
+  // 2. Daily: new date -> commit previous day, reset running stats
+  if (strncmp(dt, curDate, 10) != 0) {
+    commitDay();
+    memcpy(curDate, dt, 10);
+    curDate[10] = '\0';
+    dayMin = 100;
+    dayMax = -100;
+    dayPopMax = 0;
+    middayDiff = 9999;
+    middayCode = 3;
+  }
+
+  if (item.temp < dayMin)
+    dayMin = item.temp;
+  if (item.temp > dayMax)
+    dayMax = item.temp;
+  if (item.pop > dayPopMax)
+    dayPopMax = item.pop;
+
+  // Icon Selection (Midday Rule)
+  int diff = abs(twoDigits(dt + 11) - 12);
+  if (diff < middayDiff) {
+    middayDiff = diff;
+    middayCode = wmo;
+  }
+}
+
+void ForecastAggregator::finish() {
+  commitDay();
+  curDate[0] = '\0';
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+// Incremental aggregator for the OWM 5 day / 3 hour forecast.
+// Fed one list item at a time while the response streams in: fills the
+// first 24 slots as hourly entries and keeps running per-day min/max/pop
+// and the "midday rule" icon, committing a day when the date changes.
+// Pure C++ (no Arduino deps) so tools/forecast_bench.cpp can reuse it.
+
+struct ForecastItem {
+  uint32_t dt;       // Epoch seconds (UTC)
+  const char *dtTxt; // "YYYY-MM-DD HH:MM:SS" (UTC)
+  const char *icon;  // OWM icon id, e.g. "10d"
+  float temp;
+  float pop; // 0..1
+};
+
+class ForecastAggregator {
+public:
+  static const int MAX_HOURS = 24;
+  static const int MAX_DAYS = 7;
+
+  struct Hour {
+    uint32_t time; // Epoch seconds
+    float temp;
+    float pop;
+    int weatherCode;
+  };
+
+  struct Day {
+    uint32_t date; // Packed YYYYMMDD
+    int year, month, day;
+    float minTemp;
+    float maxTemp;
+    float pop; // Max over the day
+    int weatherCode; // Slot closest to 12:00
+  };
+
+  ForecastAggregator() { reset(); }
+  void reset();
+  void add(const ForecastItem &item);
+  void finish(); // Commits the last (partial) day
+
+  // OWM icon ("01d".."50n") -> WMO weather code used by the views
+  static int iconToWmo(const char *icon);
+
+  Hour hours[MAX_HOURS];
+  int hourCount;
+  Day days[MAX_DAYS];
+  int dayCount;
+
+private:
+  // Running state of the day being aggregated
+  char curDate[11];
+  float dayMin, dayMax, dayPopMax;
+  int middayCode, middayDiff;
+
+  void commitDay();
+};
@@ -1,6 +1,77 @@
 #include "WeatherService.h"
+#include "ForecastAggregator.h"
+#include "HttpPool.h"
+#include "NetStats.h"
+#include <Preferences.h>
 #include <WiFiClientSecure.h>
 
+GeoCacheEntry WeatherService::geoCache[GEO_CACHE_SIZE];
+bool WeatherService::geoCacheLoaded = false;
+String WeatherService::baseUrl;
+
+// --- JSON FILTER SPECS ---
+// Only the fields we actually read are ever allocated.
+
+static void buildGeoFilter(JsonDocument &filter) {
+  // [ { "name", "lat", "lon", "local_names": {...}, ... } ]
+  filter[0]["name"] = true;
+  filter[0]["lat"] = true;
+  filter[0]["lon"] = true;
+  NetStats::finishFilter(filter);
+}
+
+static void buildForecastItemFilter(JsonDocument &filter) {
+  // One element of "list": { "main", "weather", "wind", "clouds", "sys", ... }
+  filter["dt"] = true;
+  filter["main"]["temp"] = true;
+  filter["weather"][0]["icon"] = true;
+  filter["pop"] = true;
+  filter["dt_txt"] = true;
+  NetStats::finishFilter(filter);
+}
+
+static void buildCurrentFilter(JsonDocument &filter) {
+  JsonObject main = filter["main"].to<JsonObject>();
+  main["temp"] = true;
+  main["humidity"] = true;
+  main["pressure"] = true;
+  main["feels_like"] = true;
+  filter["wind"]["speed"] = true;
+  filter["wind"]["deg"] = true;
+  filter["weather"][0]["icon"] = true;
+  NetStats::finishFilter(filter);
+}
+
+static void buildAqiFilter(JsonDocument &filter) {
+  // { "list": [ { "main": { "aqi" }, "components": {...} } ] }
+  filter["list"][0]["main"]["aqi"] = true;
+  NetStats::finishFilter(filter);
+}
+
+static void buildOpenMeteoFilter(JsonDocument &filter) {
+  JsonObject current = filter["current"].to<JsonObject>();
+  current["temperature_2m"] = true;
+  current["relative_humidity_2m"] = true;
+  current["pressure_msl"] = true;
+  current["apparent_temperature"] = true;
+  current["weather_code"] = true;
+  current["wind_speed_10m"] = true;
+  current["wind_direction_10m"] = true;
+  current["is_day"] = true;
+
+  JsonObject daily = filter["daily"].to<JsonObject>();
+  daily["time"] = true;
+  daily["temperature_2m_max"] = true;
+  daily["temperature_2m_min"] = true;
+  daily["weather_code"] = true;
+
+  JsonObject hourly = filter["hourly"].to<JsonObject>();
+  hourly["time"] = true;
+  hourly["temperature_2m"] = true;
+  hourly["weather_code"] = true;
+  NetStats::finishFilter(filter);
+}
+
 // Open-Meteo URL:
 // https://api.open-meteo.com/v1/forecast?latitude=XX&longitude=YY&current_weather=true&daily=weathercode,temperature_2m_max,temperature_2m_min&timezone=auto
 
@@ -25,6 +96,18 @@ int calculateMoonPhase(int year, int month, int day) {
   return b;
 }
 
+// Open-Meteo local time "YYYY-MM-DDTHH:MM" (timezone=auto) -> epoch seconds
+static uint32_t parseLocalTime(const char *text) {
+  struct tm tm = {};
+  if (sscanf(text, "%d-%d-%dT%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+             &tm.tm_hour, &tm.tm_min) != 5)
+    return 0;
+  tm.tm_year -= 1900;
+  tm.tm_mon -= 1;
+  tm.tm_isdst = -1;
+  return (uint32_t)mktime(&tm);
+}
+
 bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
                                    String owmApiKey) {
   if (WiFi.status() != WL_CONNECTED)
@@ -42,13 +125,10 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
 
   if (!forecastSuccess) {
     // Fallback to Open-Meteo
-    WiFiClientSecure client;
-    client.setInsecure();
-    HTTPClient http;
-
     // Change http -> https
     String url =
-        "https://api.open-meteo.com/v1/forecast?latitude=" + String(lat) +
+        api("https://api.open-meteo.com") +
+        "/v1/forecast?latitude=" + String(lat) +
         "&longitude=" + String(lon) +
         "&current=temperature_2m,relative_humidity_2m,apparent_"
         "temperature,"
@@ -58,17 +138,22 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
         "1"; // Added past_days=1
 
     Serial.println("Fetching Open-Meteo: " + url);
-    http.begin(client, url); // Pass client
-    http.useHTTP10(true);    // Disable Chunked Transfer for Stream Parsing
-    http.setConnectTimeout(5000);
-    http.setTimeout(5000);
+    HTTPClient *pooled = HttpPool::begin(url, EP_OPEN_METEO);
+    if (!pooled)
+      return false; // No free client
+    HTTPClient &http = *pooled;
 
-    int httpResponseCode = http.GET();
+    int httpResponseCode = HttpPool::get(&http);
     if (httpResponseCode > 0) {
       // Stream Parsing for Memory Safety
-      JsonDocument doc; // Changed to DynamicJsonDocument if stack issue, but
-                        // JsonDocument is ArduinoJson 7
-      DeserializationError error = deserializeJson(doc, http.getStream());
+      JsonDocument filter;
+      buildOpenMeteoFilter(filter);
+      CountingAllocator alloc;
+      JsonDocument doc(&alloc);
+      DeserializationError error =
+          deserializeJson(doc, HttpPool::stream(&http),
+                          DeserializationOption::Filter(filter));
+      NetStats::recordDoc(EP_OPEN_METEO, alloc.peak());
 
       if (error) { // ... existing error handle
         Serial.print("Deserialize Open-Meteo failed: ");
@@ -111,13 +196,14 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
           if (jsonIdx >= (int)time.size())
             break;
 
-          data.daily[i].date = time[jsonIdx].template as<String>();
           data.daily[i].maxTemp = doc["daily"]["temperature_2m_max"][jsonIdx];
           data.daily[i].minTemp = doc["daily"]["temperature_2m_min"][jsonIdx];
           data.daily[i].weatherCode = doc["daily"]["weather_code"][jsonIdx];
 
-          int y, m, d;
-          if (sscanf(data.daily[i].date.c_str(), "%d-%d-%d", &y, &m, &d) == 3) {
+          int y, m, d; // "YYYY-MM-DD"
+          const char *date = time[jsonIdx] | "";
+          if (sscanf(date, "%d-%d-%d", &y, &m, &d) == 3) {
+            data.daily[i].date = y * 10000 + m * 100 + d;
             data.daily[i].moonPhaseIndex = calculateMoonPhase(y, m, d);
           }
         }
@@ -133,13 +219,13 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
           int idx = startIdx + i;
           if (idx >= (int)h_time.size())
             break;
-          data.hourly[i].time = h_time[idx].template as<String>();
+          data.hourly[i].time = parseLocalTime(h_time[idx] | "");
           data.hourly[i].temp = doc["hourly"]["temperature_2m"][idx];
           data.hourly[i].weatherCode = doc["hourly"]["weather_code"][idx];
         }
       }
     }
-    http.end();
+    HttpPool::release(&http);
   }
 
   if (!weatherSuccess)
@@ -148,21 +234,23 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
   // 2. Air Quality Forecast (OWM Air Pollution)
   // Scale 1 (Good) to 5 (Poor)
   {
-    WiFiClientSecure client;
-    client.setInsecure();
-    HTTPClient http;
     String aqiUrl =
-        "https://api.openweathermap.org/data/2.5/air_pollution?lat=" +
+        api("https://api.openweathermap.org") +
+        "/data/2.5/air_pollution?lat=" +
         String(lat) + "&lon=" + String(lon) + "&appid=" + owmApiKey;
 
     Serial.println("Fetching AQI OWM: " + aqiUrl);
-    http.begin(client, aqiUrl);
-    http.setConnectTimeout(5000);
-    http.setTimeout(5000); // 5s timeout
-    int aqiRes = http.GET();
+    HTTPClient *http = HttpPool::begin(aqiUrl, EP_OWM_AQI); // 5s timeout
+    int aqiRes = http ? HttpPool::get(http) : -1; // Optional: skip if none
     if (aqiRes > 0) {
-      JsonDocument doc;
-      DeserializationError error = deserializeJson(doc, http.getStream());
+      JsonDocument filter;
+      buildAqiFilter(filter);
+      CountingAllocator alloc;
+      JsonDocument doc(&alloc);
+      DeserializationError error =
+          deserializeJson(doc, HttpPool::stream(http),
+                          DeserializationOption::Filter(filter));
+      NetStats::recordDoc(EP_OWM_AQI, alloc.peak());
       if (!error) {
         // "list": [{ "main": { "aqi": 1 }, ... }]
         if (doc.containsKey("list")) {
@@ -176,7 +264,8 @@ bool WeatherService::updateWeather(WeatherData &data, float lat, float lon,
     } else {
       Serial.printf("AQI HTTP Error: %d\n", aqiRes);
     }
-    http.end();
+    if (http)
+      HttpPool::release(http);
   }
 
   // 3. Hybrid: Overwrite Current Weather with OpenWeatherMap if Key is present
@@ -205,33 +294,105 @@ const char *WeatherService::getAQIDesc(int aqi) {
   }
 }
 
+void WeatherService::loadGeoCache() {
+  memset(geoCache, 0, sizeof(geoCache));
+  Preferences prefs;
+  prefs.begin("weather_cfg", true); // Read-only
+  if (prefs.getBytesLength("geoCache") == sizeof(geoCache))
+    prefs.getBytes("geoCache", geoCache, sizeof(geoCache));
+  prefs.end();
+  geoCacheLoaded = true;
+}
+
+void WeatherService::saveGeoCache() {
+  Preferences prefs;
+  prefs.begin("weather_cfg", false);
+  prefs.putBytes("geoCache", geoCache, sizeof(geoCache));
+  prefs.end();
+}
+
+void WeatherService::clearGeoCache() {
+  memset(geoCache, 0, sizeof(geoCache));
+  geoCacheLoaded = true;
+  Preferences prefs;
+  prefs.begin("weather_cfg", false);
+  prefs.remove("geoCache");
+  prefs.end();
+  Serial.println("Geocode cache cleared");
+}
+
+void WeatherService::storeGeoCache(const String &city, float lat, float lon,
+                                   const String &resolvedName) {
+  // A truncated key would never match the lookup again: a miss and a
+  // flash write on every refresh. Such names just aren't cached.
+  if (city.length() >= sizeof(geoCache[0].city))
+    return;
+
+  // Reuse the city's slot or the first free one, else evict the oldest
+  int slot = GEO_CACHE_SIZE - 1;
+  for (int i = 0; i < GEO_CACHE_SIZE; i++) {
+    if (geoCache[i].city[0] == '\0' || city == geoCache[i].city) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot == GEO_CACHE_SIZE - 1 && geoCache[slot].city[0] != '\0' &&
+      city != geoCache[slot].city) {
+    memmove(&geoCache[0], &geoCache[1],
+            sizeof(GeoCacheEntry) * (GEO_CACHE_SIZE - 1));
+  }
+
+  GeoCacheEntry &e = geoCache[slot];
+  strlcpy(e.city, city.c_str(), sizeof(e.city));
+  strlcpy(e.resolved, resolvedName.c_str(), sizeof(e.resolved));
+  e.lat = lat;
+  e.lon = lon;
+  saveGeoCache();
+}
+
 bool WeatherService::lookupCoordinates(String cityName, float &lat, float &lon,
                                        String &resolvedName, String apiKey) {
+  // 1. Cache (no network needed)
+  if (!geoCacheLoaded)
+    loadGeoCache();
+  for (int i = 0; i < GEO_CACHE_SIZE; i++) {
+    if (geoCache[i].city[0] != '\0' && cityName == geoCache[i].city) {
+      lat = geoCache[i].lat;
+      lon = geoCache[i].lon;
+      resolvedName = geoCache[i].resolved;
+      return true;
+    }
+  }
+
   if (WiFi.status() != WL_CONNECTED)
     return false;
 
-  WiFiClientSecure client;
-  client.setInsecure();
-  HTTPClient http;
-
   // URL Encode city name
   String encodedCity = cityName;
   encodedCity.replace(" ", "%20");
 
   // OWM Geocoding
   String url =
-      "https://api.openweathermap.org/geo/1.0/direct?q=" + encodedCity +
+      api("https://api.openweathermap.org") +
+      "/geo/1.0/direct?q=" + encodedCity +
       "&limit=1&appid=" + apiKey;
 
   Serial.println("Geocoding city OWM: " + url);
-  http.begin(client, url);
-  http.setConnectTimeout(5000);
-  http.setTimeout(5000);
+  HTTPClient *pooled = HttpPool::begin(url, EP_OWM_GEO);
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
 
-  int httpResponseCode = http.GET();
+  int httpResponseCode = HttpPool::get(&http);
   if (httpResponseCode > 0) {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, http.getStream());
+    JsonDocument filter;
+    buildGeoFilter(filter);
+    CountingAllocator alloc;
+    JsonDocument doc(&alloc);
+    DeserializationError error =
+        deserializeJson(doc, HttpPool::stream(&http),
+                        DeserializationOption::Filter(filter));
+    NetStats::recordDoc(EP_OWM_GEO, alloc.peak());
 
     // Expecting an Array [ { "name": ... } ]
     if (!error && doc.is<JsonArray>() && doc.size() > 0) {
@@ -242,218 +403,139 @@ bool WeatherService::lookupCoordinates(String cityName, float &lat, float &lon,
 
       Serial.printf("Resolved %s to %.4f, %.4f (%s)\n", cityName.c_str(), lat,
                     lon, resolvedName.c_str());
+      storeGeoCache(cityName, lat, lon, resolvedName);
 
-      http.end();
+      HttpPool::release(&http);
       return true;
     }
 
     Serial.print("Geocoding failed/parsed error: ");
     Serial.println(error.c_str());
-    http.end();
+    HttpPool::release(&http);
     return false;
   }
   Serial.printf("Geocoding HTTP Error: %d\n", httpResponseCode);
-  http.end();
+  HttpPool::release(&http);
   return false;
 }
 
 bool WeatherService::updateForecastOWM_5Day(WeatherData &data, float lat,
                                             float lon, String apiKey) {
-  WiFiClientSecure client;
-  client.setInsecure();
-  HTTPClient http;
-
   // 5 Day / 3 Hour Forecast
   String url =
-      "https://api.openweathermap.org/data/2.5/forecast?lat=" + String(lat) +
+      api("https://api.openweathermap.org") +
+      "/data/2.5/forecast?lat=" + String(lat) +
       "&lon=" + String(lon) + "&appid=" + apiKey + "&units=metric";
 
   Serial.println("Fetching OWM Forecast 5Day: " + url);
-  http.begin(client, url);
-  http.setConnectTimeout(6000);
-  http.setTimeout(6000);
-
-  int code = http.GET();
-  if (code > 0) {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, http.getStream());
+  HTTPClient *pooled = HttpPool::begin(url, EP_OWM_FORECAST, 6000);
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
 
-    if (!error) {
-      JsonArray list = doc["list"];
-      if (list.size() > 0) {
-
-        // 1. Fill Hourly (actually 3-hour steps) - Take first 24 items (72h
-        // coverage)
-        for (int i = 0; i < 24 && i < list.size(); i++) {
-          JsonObject item = list[i];
-          data.hourly[i].temp = item["main"]["temp"];
-          String dt_txt = item["dt_txt"].as<String>();
-          data.hourly[i].time = dt_txt; // "YYYY-MM-DD HH:MM:SS"
-
-          float pop = item["pop"]; // 0..1
-          data.hourly[i].pop = pop;
-
-          // Map Icon
-          String icon = item["weather"][0]["icon"].as<String>();
-          int wmo = 3;
-          if (icon.startsWith("01"))
-            wmo = 0;
-          else if (icon.startsWith("02"))
-            wmo = 1;
-          else if (icon.startsWith("03"))
-            wmo = 2;
-          else if (icon.startsWith("04"))
-            wmo = 3;
-          else if (icon.startsWith("09"))
-            wmo = 80;
-          else if (icon.startsWith("10"))
-            wmo = 61;
-          else if (icon.startsWith("11"))
-            wmo = 95;
-          else if (icon.startsWith("13"))
-            wmo = 71;
-          else if (icon.startsWith("50"))
-            wmo = 45;
-          data.hourly[i].weatherCode = wmo;
-        }
+  int code = HttpPool::get(&http);
+  if (code <= 0) {
+    Serial.printf("OWM Forecast HTTP Error: %d\n", code);
+    HttpPool::release(&http);
+    return false;
+  }
 
-        // Current Rain Prob Proxy (use first forecast slot)
-        data.currentRainProb = data.hourly[0].pop;
-
-        // 2. Fill Daily (Aggregate by Day) - Use "Midday Rule" & Max POP
-        int dayIndex = 0;
-        String currentDay = "";
-        float dayMin = 100, dayMax = -100;
-        float dayPopMax = 0;
-        int middayIconCode = 3;
-        int middayDiff = 9999;
-
-        for (JsonObject item : list) {
-          String dt_txt = item["dt_txt"].as<String>();
-          String dayStr = dt_txt.substring(0, 10);   // YYYY-MM-DD
-          String timeStr = dt_txt.substring(11, 16); // HH:MM
-          int hour = timeStr.substring(0, 2).toInt();
-
-          if (currentDay == "")
-            currentDay = dayStr;
-
-          if (dayStr != currentDay) {
-            // Commit previous day
-            if (dayIndex < 7) {
-              data.daily[dayIndex].date = currentDay;
-              data.daily[dayIndex].maxTemp = dayMax;
-              data.daily[dayIndex].minTemp = dayMin;
-              data.daily[dayIndex].weatherCode = middayIconCode;
-              data.daily[dayIndex].pop = dayPopMax;
-
-              int y, m, d;
-              if (sscanf(currentDay.c_str(), "%d-%d-%d", &y, &m, &d) == 3) {
-                data.daily[dayIndex].moonPhaseIndex =
-                    calculateMoonPhase(y, m, d);
-              }
-
-              dayIndex++;
-            }
-            // Reset for new day
-            currentDay = dayStr;
-            dayMin = 100;
-            dayMax = -100;
-            dayPopMax = 0;
-            middayDiff = 9999;
-            middayIconCode = 3;
-          }
+  // STREAM PARSING: {"cod":"200",...,"list":[{...},{...}],"city":{...}}
+  // List items are deserialized one at a time and folded into the
+  // aggregator, so at most one item is ever held in RAM.
+  JsonDocument filter;
+  buildForecastItemFilter(filter);
+
+  ForecastAggregator agg;
+  DeserializationError error;
+  size_t peakItemBytes = 0;
+  Stream &stream = HttpPool::stream(&http);
+  if (stream.find("\"list\":[")) {
+    do {
+      CountingAllocator alloc;
+      JsonDocument item(&alloc);
+      error = deserializeJson(item, stream,
+                              DeserializationOption::Filter(filter));
+      if (alloc.peak() > peakItemBytes)
+        peakItemBytes = alloc.peak();
+      if (error)
+        break;
+
+      ForecastItem fi;
+      fi.dt = item["dt"];
+      fi.dtTxt = item["dt_txt"];
+      fi.icon = item["weather"][0]["icon"];
+      fi.temp = item["main"]["temp"];
+      fi.pop = item["pop"]; // 0..1
+      agg.add(fi);
+    } while (stream.findUntil(",", "]"));
+  }
+  agg.finish();
+  NetStats::recordDoc(EP_OWM_FORECAST, peakItemBytes);
+  HttpPool::release(&http);
 
-          // Stats
-          float t = item["main"]["temp"];
-          if (t < dayMin)
-            dayMin = t;
-          if (t > dayMax)
-            dayMax = t;
-
-          float p = item["pop"];
-          if (p > dayPopMax)
-            dayPopMax = p;
-
-          // Icon Selection (Midday Rule)
-          int diff = abs(hour - 12);
-          if (diff < middayDiff) {
-            middayDiff = diff;
-            String icon = item["weather"][0]["icon"].as<String>();
-            int wmo = 3;
-            if (icon.startsWith("01"))
-              wmo = 0;
-            else if (icon.startsWith("02"))
-              wmo = 1;
-            else if (icon.startsWith("03"))
-              wmo = 2;
-            else if (icon.startsWith("04"))
-              wmo = 3;
-            else if (icon.startsWith("09"))
-              wmo = 80;
-            else if (icon.startsWith("10"))
-              wmo = 61;
-            else if (icon.startsWith("11"))
-              wmo = 95;
-            else if (icon.startsWith("13"))
-              wmo = 71;
-            else if (icon.startsWith("50"))
-              wmo = 45;
-            middayIconCode = wmo;
-          }
-        }
+  if (error) {
+    Serial.print("OWM Forecast JSON Error: ");
+    Serial.println(error.c_str());
+    return false;
+  }
+  if (agg.hourCount == 0) {
+    Serial.println("OWM Forecast: empty list");
+    return false;
+  }
 
-        // Commit last day
-        if (dayIndex < 7) {
-          data.daily[dayIndex].date = currentDay;
-          data.daily[dayIndex].maxTemp = dayMax;
-          data.daily[dayIndex].minTemp = dayMin;
-          data.daily[dayIndex].weatherCode = middayIconCode;
-          data.daily[dayIndex].pop = dayPopMax;
-
-          int y, m, d;
-          if (sscanf(currentDay.c_str(), "%d-%d-%d", &y, &m, &d) == 3) {
-            data.daily[dayIndex].moonPhaseIndex = calculateMoonPhase(y, m, d);
-          }
-        }
-        // Set current moon phase from today's forecast
-        if (dayIndex > 0 || (dayIndex == 0 && currentDay != "")) {
-          data.currentMoonPhase = data.daily[0].moonPhaseIndex;
-        }
+  // 1. Hourly (3-hour steps)
+  for (int i = 0; i < agg.hourCount; i++) {
+    data.hourly[i].time = agg.hours[i].time;
+    data.hourly[i].temp = agg.hours[i].temp;
+    data.hourly[i].pop = agg.hours[i].pop;
+    data.hourly[i].weatherCode = agg.hours[i].weatherCode;
+  }
 
-        Serial.println("OWM Forecast 5Day Success");
-        http.end();
-        return true;
-      }
-    } else {
-      Serial.print("OWM Forecast JSON Error: ");
-      Serial.println(error.c_str());
-    }
-  } else {
-    Serial.printf("OWM Forecast HTTP Error: %d\n", code);
+  // Current Rain Prob Proxy (use first forecast slot)
+  data.currentRainProb = data.hourly[0].pop;
+
+  // 2. Daily (Midday Rule icon & Max POP)
+  for (int i = 0; i < agg.dayCount; i++) {
+    const ForecastAggregator::Day &d = agg.days[i];
+    data.daily[i].date = d.date;
+    data.daily[i].maxTemp = d.maxTemp;
+    data.daily[i].minTemp = d.minTemp;
+    data.daily[i].weatherCode = d.weatherCode;
+    data.daily[i].pop = d.pop;
+    data.daily[i].moonPhaseIndex = calculateMoonPhase(d.year, d.month, d.day);
   }
-  http.end();
-  return false;
+  // Set current moon phase from today's forecast
+  if (agg.dayCount > 0)
+    data.currentMoonPhase = data.daily[0].moonPhaseIndex;
+
+  Serial.println("OWM Forecast 5Day Success");
+  return true;
 }
 
 bool WeatherService::updateCurrentWeatherOWM(WeatherData &data, float lat,
                                              float lon, String apiKey) {
-  WiFiClientSecure client;
-  client.setInsecure();
-  HTTPClient http;
-
   String url =
-      "https://api.openweathermap.org/data/2.5/weather?lat=" + String(lat) +
+      api("https://api.openweathermap.org") +
+      "/data/2.5/weather?lat=" + String(lat) +
       "&lon=" + String(lon) + "&appid=" + apiKey + "&units=metric";
 
   Serial.println("Fetching OWM Current: " + url);
-  http.begin(client, url);
-  http.setConnectTimeout(5000);
-  http.setTimeout(5000);
+  HTTPClient *pooled = HttpPool::begin(url, EP_OWM_CURRENT);
+  if (!pooled)
+    return false; // No free client
+  HTTPClient &http = *pooled;
 
-  int code = http.GET();
+  int code = HttpPool::get(&http);
   if (code > 0) {
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, http.getStream());
+    JsonDocument filter;
+    buildCurrentFilter(filter);
+    CountingAllocator alloc;
+    JsonDocument doc(&alloc);
+    DeserializationError error =
+        deserializeJson(doc, HttpPool::stream(&http),
+                        DeserializationOption::Filter(filter));
+    NetStats::recordDoc(EP_OWM_CURRENT, alloc.peak());
     if (!error) {
       if (doc.containsKey("main")) {
         // Overwrite Data
@@ -468,31 +550,12 @@ bool WeatherService::updateCurrentWeatherOWM(WeatherData &data, float lat,
         // Icon Mapping
         String icon = doc["weather"][0]["icon"].as<String>();
         data.isNight = icon.endsWith("n");
-        int wmo = 3; // Default Overcast
-
-        if (icon.startsWith("01"))
-          wmo = 0; // Clear
-        else if (icon.startsWith("02"))
-          wmo = 1; // Few Clouds
-        else if (icon.startsWith("03"))
-          wmo = 2; // Scattered
-        else if (icon.startsWith("04"))
-          wmo = 3; // Broken
-        else if (icon.startsWith("09"))
-          wmo = 80; // Shower Rain
-        else if (icon.startsWith("10"))
-          wmo = 61; // Rain
-        else if (icon.startsWith("11"))
-          wmo = 95; // Thunder
-        else if (icon.startsWith("13"))
-          wmo = 71; // Snow
-        else if (icon.startsWith("50"))
-          wmo = 45; // Mist
+        int wmo = ForecastAggregator::iconToWmo(icon.c_str());
 
         data.currentWeatherCode = wmo;
         Serial.printf("OWM Update Success: Temp=%.1f Icon=%s WMO=%d\n",
                       data.currentTemp, icon.c_str(), wmo);
-        http.end();
+        HttpPool::release(&http);
         return true;
       }
     } else {
@@ -502,6 +565,6 @@ bool WeatherService::updateCurrentWeatherOWM(WeatherData &data, float lat,
   } else {
     Serial.printf("OWM HTTP Error: %d\n", code);
   }
-  http.end();
+  HttpPool::release(&http);
   return false;
 }
@@ -3,41 +3,67 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
+#include <type_traits>
+
+// Flat, String-free weather record: copies are a single memcpy and never
+// touch the heap. Dates/times are stored raw and formatted by the views.
 
 struct DailyForecast {
-  String date;
+  uint32_t date; // Packed YYYYMMDD (e.g. 20250314), 0 = empty slot
   float maxTemp;
   float minTemp;
-  int weatherCode;
-  int moonPhaseIndex;
   float pop; // Probability of Precipitation (0..1)
+  uint8_t weatherCode; // WMO code
+  uint8_t moonPhaseIndex;
 };
 
 struct HourlyForecast {
-  String time;
+  uint32_t time; // Epoch seconds of the slot start, 0 = empty slot
   float temp;
-  int weatherCode;
   float pop; // Probability of Precipitation (0..1)
+  uint8_t weatherCode; // WMO code
 };
 
+#define WEATHER_CITY_LEN 48
+
 struct WeatherData {
-  String cityName;
+  char cityName[WEATHER_CITY_LEN];
   float currentTemp;
-  int currentWeatherCode;
-  int currentHumidity;
   float currentPressure;
   float currentFeelsLike;
-  int currentMoonPhase;
-  int currentAQI;
   float windSpeed;
-  int windDirection;
-  float currentRainProb; // New
-  bool isNight;          // New: For icon selection
-  uint32_t lastUpdate;   // Timestamp of last successful update
+  float currentRainProb;
+  uint32_t lastUpdate; // millis() of last successful update
+  int16_t windDirection;
+  uint8_t currentWeatherCode;
+  uint8_t currentHumidity;
+  uint8_t currentMoonPhase;
+  uint8_t currentAQI;
+  bool isNight; // For icon selection
   DailyForecast daily[7];
   HourlyForecast hourly[24];
 };
 
+static_assert(std::is_trivially_copyable<WeatherData>::value,
+              "WeatherData must stay memcpy-able (no String members)");
+static_assert(sizeof(WeatherData) <= 608, "WeatherData grew unexpectedly");
+
+// Formatting helpers for the packed fields
+inline int dailyYear(uint32_t date) { return date / 10000; }
+inline int dailyMonth(uint32_t date) { return (date / 100) % 100; }
+inline int dailyDay(uint32_t date) { return date % 100; }
+
+// Geocoding results are stable per city name, so they are cached in NVS
+// (weather_cfg namespace) and only dropped when the city list changes.
+#define GEO_CACHE_SIZE 5 // Matches NetworkManager::getCities() limit
+
+struct GeoCacheEntry {
+  char city[48];     // Configured city string (cache key)
+  char resolved[48]; // Name returned by the geocoder
+  float lat;
+  float lon;
+};
+
 class WeatherService {
 public:
   static bool updateWeather(WeatherData &data, float lat, float lon,
@@ -45,8 +71,25 @@ public:
   static bool lookupCoordinates(String cityName, float &lat, float &lon,
                                 String &resolvedName, String apiKey);
   static const char *getAQIDesc(int aqi);
+  static void clearGeoCache(); // Call when the configured cities change
+
+  // Serve OWM and Open-Meteo from another origin, e.g.
+  // "http://192.168.1.10:8080" (tools/replay_server.py). Empty: real APIs.
+  static void setBaseUrl(const String &url) { baseUrl = url; }
 
 private:
+  static String baseUrl;
+  static String api(const char *origin) {
+    return baseUrl.isEmpty() ? String(origin) : baseUrl;
+  }
+
+  static GeoCacheEntry geoCache[GEO_CACHE_SIZE];
+  static bool geoCacheLoaded;
+  static void loadGeoCache();
+  static void saveGeoCache();
+  static void storeGeoCache(const String &city, float lat, float lon,
+                            const String &resolvedName);
+
   static bool updateCurrentWeatherOWM(WeatherData &data, float lat, float lon,
                                       String apiKey);
   static bool updateForecastOWM_5Day(WeatherData &data, float lat, float lon,
@@ -0,0 +1,71 @@
+// Host driver for the native env: runs the real DataManager network task
+// (services, FetchScheduler, HttpPool, CacheStore) on Linux against the live
+// APIs and prints every event the GUI task would receive.
+//
+//   pio run -e native
+//   WEATHER_CITIES=Barcelona OWM_API_KEY=... .pio/build/native/program [s]
+//
+// Runs for [s] seconds (default 120, 0 = forever), then prints the pool,
+// endpoint and snapshot statistics. Settings: native/stubs/NetworkManager.h
+
+#include "DataManager.h"
+#include "GuiController.h"
+#include <Arduino.h>
+
+static const char *sourceName(DataSource s) {
+  static const char *names[] = {"weather", "bus", "stock"};
+  return s <= SRC_STOCK ? names[s] : "?";
+}
+
+static void printEvent(const DataEvent &ev) {
+  static const char *types[] = {"started", "ready", "failed", "cached"};
+  Serial.printf("EVENT: %-7s %-7s idx=%d queued %u us\n", sourceName(ev.source),
+                types[ev.type], ev.index,
+                (unsigned)(micros() - ev.postedUs));
+  if (ev.type != EVT_DATA_READY)
+    return;
+
+  switch (ev.source) {
+  case SRC_WEATHER: {
+    const WeatherData &w = DataManager::getWeatherData();
+    Serial.printf("  %s %.1f C, code %u, %u%% humidity, AQI %u\n", w.cityName,
+                  w.currentTemp, w.currentWeatherCode, w.currentHumidity,
+                  w.currentAQI);
+    break;
+  }
+  case SRC_BUS: {
+    const BusData &b = DataManager::getBusData();
+    Serial.printf("  %s (%s): %u arrivals\n", b.stopName.c_str(),
+                  b.stopCode.c_str(), (unsigned)b.arrivals.size());
+    for (const BusArrival &a : b.arrivals)
+      Serial.printf("    %-5s %-28s %s\n", a.line.c_str(),
+                    a.destination.c_str(), a.text.c_str());
+    break;
+  }
+  case SRC_STOCK: {
+    for (const StockItem &s : DataManager::getStockData())
+      Serial.printf("  %-8s %10.2f %+6.2f%%%s\n", s.symbol.c_str(), s.price,
+                    s.changePercent, s.isValid ? "" : " (invalid)");
+    break;
+  }
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t seconds = argc > 1 ? strtoul(argv[1], nullptr, 10) : 120;
+  Serial.begin(115200);
+  DataManager::begin();
+
+  uint32_t start = millis();
+  while (seconds == 0 || millis() - start < seconds * 1000) {
+    GuiController::waitWake(1000);
+    DataEvent ev;
+    while (DataManager::pollEvent(ev))
+      printEvent(ev);
+  }
+
+  DataManager::printNetStats();
+  Serial.flush();
+  // The network task never returns; skip static destructors it may be using
+  quick_exit(0);
+}
@@ -0,0 +1,47 @@
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+static const auto bootTime = std::chrono::steady_clock::now();
+
+uint32_t millis() {
+  auto d = std::chrono::steady_clock::now() - bootTime;
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(d)
+      .count();
+}
+
+uint32_t micros() {
+  auto d = std::chrono::steady_clock::now() - bootTime;
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(d)
+      .count();
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() { std::this_thread::yield(); }
+
+bool getLocalTime(struct tm *info, uint32_t ms) {
+  (void)ms;
+  time_t now = time(nullptr);
+  localtime_r(&now, info);
+  return info->tm_year > (2016 - 1900);
+}
+
+size_t HardwareSerial::write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t n) {
+  return fwrite(buf, 1, n, stdout);
+}
+
+void HardwareSerial::flush() { fflush(stdout); }
@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct NativeTask {
+  std::string name;
+  std::mutex m;
+  std::condition_variable cv;
+  uint32_t notify = 0;
+};
+
+struct NativeQueue {
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+  std::mutex m;
+  std::condition_variable cv;
+};
+
+static thread_local NativeTask *currentTask = nullptr;
+
+// Waits on cv until pred() or the timeout; portMAX_DELAY waits forever
+template <typename Pred>
+static bool waitFor(std::condition_variable &cv,
+                    std::unique_lock<std::mutex> &lock, TickType_t ticks,
+                    Pred pred) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(lock, pred);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks), pred);
+}
+
+// --- Tasks ---
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name,
+                                   uint32_t stackDepth, void *param,
+                                   UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core) {
+  (void)stackDepth;
+  (void)priority;
+  (void)core;
+  NativeTask *task = new NativeTask(); // Lives as long as the process
+  task->name = name ? name : "";
+  if (handle)
+    *handle = task;
+  std::thread([task, fn, param] {
+    currentTask = task;
+    fn(param);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority,
+                       TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle,
+                                 tskNO_AFFINITY);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  if (!currentTask) // main() or a thread not started through xTaskCreate
+    currentTask = new NativeTask();
+  return currentTask;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+TickType_t xTaskGetTickCount() { return millis(); }
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  {
+    std::lock_guard<std::mutex> lock(task->m);
+    task->notify++;
+  }
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+  xTaskNotifyGive(task);
+  if (woken)
+    *woken = pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+  NativeTask *task = xTaskGetCurrentTaskHandle();
+  std::unique_lock<std::mutex> lock(task->m);
+  waitFor(task->cv, lock, ticks, [task] { return task->notify > 0; });
+  uint32_t value = task->notify;
+  if (value)
+    task->notify = clearOnExit ? 0 : value - 1;
+  return value;
+}
+
+// --- Queues ---
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  NativeQueue *q = new NativeQueue();
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t q) { delete q; }
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!waitFor(q->cv, lock, ticks,
+               [q] { return q->items.size() < q->length; }))
+    return errQUEUE_FULL;
+  const uint8_t *p = (const uint8_t *)item;
+  q->items.emplace_back(p, p + (p ? q->itemSize : 0));
+  lock.unlock();
+  q->cv.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(q->m);
+  if (!waitFor(q->cv, lock, ticks, [q] { return !q->items.empty(); }))
+    return pdFALSE;
+  if (item && q->itemSize)
+    memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  lock.unlock();
+  q->cv.notify_all();
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+  std::lock_guard<std::mutex> lock(q->m);
+  return q->items.size();
+}
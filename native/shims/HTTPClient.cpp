@@ -0,0 +1,148 @@
+#include <HTTPClient.h>
+
+bool HTTPClient::begin(WiFiClient &client, const String &url) {
+  this->client = &client;
+  collected.clear();
+  extraHeaders = "";
+  size = -1;
+
+  // scheme://host[:port]/path?query
+  int start = url.indexOf("://");
+  String scheme = start < 0 ? String("http") : url.substring(0, start);
+  start = start < 0 ? 0 : start + 3;
+  int slash = url.indexOf('/', start);
+  String hostPort = slash < 0 ? url.substring(start) : url.substring(start, slash);
+  uri = slash < 0 ? String("/") : url.substring(slash);
+
+  port = scheme == "https" ? 443 : 80;
+  int colon = hostPort.indexOf(':');
+  if (colon >= 0) {
+    port = hostPort.substring(colon + 1).toInt();
+    hostPort = hostPort.substring(0, colon);
+  }
+  host = hostPort;
+  return !host.isEmpty();
+}
+
+void HTTPClient::addHeader(const String &name, const String &value) {
+  extraHeaders += name + ": " + value + "\r\n";
+}
+
+void HTTPClient::collectHeaders(const char *names[], size_t count) {
+  collected.clear();
+  for (size_t i = 0; i < count; i++)
+    collected.push_back({names[i], ""});
+}
+
+String HTTPClient::header(const char *name) {
+  for (const Header &h : collected) {
+    if (h.name.equalsIgnoreCase(name))
+      return h.value;
+  }
+  return String();
+}
+
+int HTTPClient::GET() {
+  if (!client)
+    return HTTPC_ERROR_NOT_CONNECTED;
+
+  // Reuse the open socket only for the same host
+  if (client->connected() && (connHost != host || connPort != port))
+    client->stop();
+  if (!client->connected()) {
+    if (!client->connect(host.c_str(), port, connectTimeout))
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    connHost = host;
+    connPort = port;
+  }
+  client->setTimeout(timeout);
+
+  String req = "GET " + uri + (http10 ? " HTTP/1.0\r\n" : " HTTP/1.1\r\n");
+  req += "Host: " + host;
+  if (port != 80 && port != 443)
+    req += ":" + String(port);
+  req += "\r\nUser-Agent: " + userAgent + "\r\nConnection: ";
+  req += (reuse && !http10) ? "keep-alive" : "close";
+  req += "\r\nAccept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n";
+  req += extraHeaders + "\r\n";
+  if (client->write((const uint8_t *)req.c_str(), req.length()) !=
+      req.length()) {
+    client->stop();
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+  }
+  return readResponseHeaders();
+}
+
+bool HTTPClient::readLine(String &line) {
+  line = "";
+  uint32_t start = millis();
+  while (millis() - start < timeout) {
+    int c = client->read();
+    if (c < 0) {
+      if (!client->connected())
+        return false;
+      delay(1);
+      continue;
+    }
+    if (c == '\n')
+      return true;
+    if (c != '\r')
+      line += (char)c;
+  }
+  return false;
+}
+
+int HTTPClient::readResponseHeaders() {
+  for (Header &h : collected)
+    h.value = "";
+  size = -1;
+  canReuse = reuse && !http10;
+
+  String line;
+  if (!readLine(line)) {
+    int err = client->connected() ? HTTPC_ERROR_READ_TIMEOUT
+                                  : HTTPC_ERROR_CONNECTION_LOST;
+    client->stop();
+    return err;
+  }
+  if (!line.startsWith("HTTP/1.")) {
+    client->stop();
+    return HTTPC_ERROR_NO_HTTP_SERVER;
+  }
+  if (line.startsWith("HTTP/1.0"))
+    canReuse = false;
+  int code = line.substring(9, 12).toInt();
+
+  while (readLine(line)) {
+    if (line.isEmpty())
+      return code > 0 ? code : HTTPC_ERROR_NO_HTTP_SERVER;
+    int colon = line.indexOf(':');
+    if (colon < 0)
+      continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length"))
+      size = value.toInt();
+    else if (name.equalsIgnoreCase("Connection") &&
+             value.equalsIgnoreCase("close"))
+      canReuse = false;
+    for (Header &h : collected) {
+      if (h.name.equalsIgnoreCase(name))
+        h.value = value;
+    }
+  }
+  client->stop();
+  return HTTPC_ERROR_READ_TIMEOUT;
+}
+
+void HTTPClient::end() {
+  if (!client)
+    return;
+  if (client->connected() && reuse && canReuse) {
+    while (client->available() > 0) // Unread tail of this response
+      client->read();
+  } else {
+    client->stop();
+  }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <vector>
+
+// Error codes as in the ESP32 HTTPClient
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_NO_CONTENT = 204,
+  HTTP_CODE_MOVED_PERMANENTLY = 301,
+  HTTP_CODE_FOUND = 302,
+  HTTP_CODE_NOT_MODIFIED = 304,
+  HTTP_CODE_BAD_REQUEST = 400,
+  HTTP_CODE_UNAUTHORIZED = 401,
+  HTTP_CODE_FORBIDDEN = 403,
+  HTTP_CODE_NOT_FOUND = 404,
+  HTTP_CODE_TOO_MANY_REQUESTS = 429,
+  HTTP_CODE_INTERNAL_SERVER_ERROR = 500,
+  HTTP_CODE_SERVICE_UNAVAILABLE = 503
+} t_http_codes;
+
+// GET-only HTTP/1.1 client with the ESP32 HTTPClient call sequence
+// (begin/GET/getStreamPtr/end, setReuse keep-alive). Like the device, the
+// body is left on the socket: chunked framing is the caller's job
+// (BufferedStream).
+class HTTPClient {
+public:
+  bool begin(WiFiClient &client, const String &url);
+  void end();
+
+  void setReuse(bool reuse) { this->reuse = reuse; }
+  void setConnectTimeout(int32_t ms) { connectTimeout = ms; }
+  void setTimeout(uint16_t ms) { timeout = ms; }
+  void setUserAgent(const String &ua) { userAgent = ua; }
+  void useHTTP10(bool on = true) { http10 = on; }
+  void addHeader(const String &name, const String &value);
+  void collectHeaders(const char *names[], size_t count);
+
+  int GET();
+
+  String header(const char *name);
+  int getSize() { return size; }
+  WiFiClient *getStreamPtr() { return client; }
+  WiFiClient &getStream() { return *client; }
+  bool connected() { return client && client->connected(); }
+
+private:
+  struct Header {
+    String name;
+    String value;
+  };
+
+  WiFiClient *client = nullptr;
+  String host, uri;
+  uint16_t port = 80;
+  String connHost; // Host:port the open socket belongs to
+  uint16_t connPort = 0;
+
+  bool reuse = true;
+  bool canReuse = false; // Server allows keep-alive
+  bool http10 = false;
+  int32_t connectTimeout = 5000;
+  uint16_t timeout = 5000;
+  String userAgent = "ESP32HTTPClient";
+  String extraHeaders;
+  std::vector<Header> collected;
+  int size = -1;
+
+  int readResponseHeaders();
+  bool readLine(String &line);
+};
@@ -0,0 +1,51 @@
+#include <LittleFS.h>
+
+#include <filesystem>
+#include <sys/stat.h>
+
+fs::LittleFSFS LittleFS;
+
+size_t fs::File::size() {
+  if (!f)
+    return 0;
+  struct stat st;
+  fflush(f.get());
+  return fstat(fileno(f.get()), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+bool fs::LittleFSFS::begin(bool formatOnFail, const char *basePath,
+                           uint8_t maxOpenFiles, const char *label) {
+  (void)formatOnFail;
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)label;
+  const char *dir = getenv("NATIVE_FS_DIR");
+  root = dir ? dir : ".pio/native_fs";
+  std::error_code ec;
+  std::filesystem::create_directories(root.c_str(), ec);
+  return std::filesystem::is_directory(root.c_str(), ec);
+}
+
+fs::File fs::LittleFSFS::open(const char *path, const char *mode) {
+  String m = mode;
+  m += "b";
+  FILE *f = fopen(hostPath(path).c_str(), m.c_str());
+  return f ? File(f) : File();
+}
+
+bool fs::LittleFSFS::exists(const char *path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool fs::LittleFSFS::remove(const char *path) {
+  return ::remove(hostPath(path).c_str()) == 0;
+}
+
+bool fs::LittleFSFS::rename(const char *from, const char *to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool fs::LittleFSFS::mkdir(const char *path) {
+  return ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Arduino.h>
+#include <memory>
+
+// LittleFS mapped onto a host directory (native env). The root is
+// $NATIVE_FS_DIR, or .pio/native_fs relative to the working directory.
+namespace fs {
+
+class File {
+public:
+  File() {}
+  explicit File(FILE *f) : f(f, fclose) {}
+
+  size_t write(const uint8_t *buf, size_t n) {
+    return f ? fwrite(buf, 1, n, f.get()) : 0;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  size_t read(uint8_t *buf, size_t n) {
+    return f ? fread(buf, 1, n, f.get()) : 0;
+  }
+  int read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  size_t size();
+  void close() { f.reset(); }
+  operator bool() const { return (bool)f; }
+
+private:
+  std::shared_ptr<FILE> f;
+};
+
+class LittleFSFS {
+public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs",
+             uint8_t maxOpenFiles = 10, const char *label = "spiffs");
+  File open(const char *path, const char *mode = "r");
+  bool exists(const char *path);
+  bool remove(const char *path);
+  bool rename(const char *from, const char *to);
+  bool mkdir(const char *path);
+
+private:
+  String root;
+  String hostPath(const char *path) const { return root + path; }
+};
+
+} // namespace fs
+
+using fs::File;
+extern fs::LittleFSFS LittleFS;
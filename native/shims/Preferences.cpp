@@ -0,0 +1,109 @@
+#include <Preferences.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> Namespace;
+
+static std::map<std::string, Namespace> store;
+static std::mutex storeMutex;
+
+bool Preferences::begin(const char *name, bool readOnly) {
+  ns = name;
+  open = true;
+  this->readOnly = readOnly;
+  return true;
+}
+
+void Preferences::end() { open = false; }
+
+bool Preferences::clear() {
+  if (!open || readOnly)
+    return false;
+  std::lock_guard<std::mutex> lock(storeMutex);
+  store[ns.c_str()].clear();
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!open || readOnly)
+    return false;
+  std::lock_guard<std::mutex> lock(storeMutex);
+  return store[ns.c_str()].erase(key) > 0;
+}
+
+bool Preferences::isKey(const char *key) { return getBytesLength(key) > 0; }
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!open || readOnly)
+    return 0;
+  std::lock_guard<std::mutex> lock(storeMutex);
+  const uint8_t *p = (const uint8_t *)value;
+  store[ns.c_str()][key].assign(p, p + len);
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!open)
+    return 0;
+  std::lock_guard<std::mutex> lock(storeMutex);
+  Namespace &n = store[ns.c_str()];
+  auto it = n.find(key);
+  return it == n.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  if (!open)
+    return 0;
+  std::lock_guard<std::mutex> lock(storeMutex);
+  Namespace &n = store[ns.c_str()];
+  auto it = n.find(key);
+  if (it == n.end() || it->second.size() > maxLen)
+    return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::putString(const char *key, const String &value) {
+  return putBytes(key, value.c_str(), value.length() + 1);
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) {
+  size_t len = getBytesLength(key);
+  if (len == 0)
+    return defaultValue;
+  std::vector<char> buf(len);
+  getBytes(key, buf.data(), len);
+  buf[len - 1] = '\0';
+  return String(buf.data());
+}
+
+template <typename T>
+static T getValue(Preferences &p, const char *key, T defaultValue) {
+  T v;
+  return p.getBytesLength(key) == sizeof(T) && p.getBytes(key, &v, sizeof(T))
+             ? v
+             : defaultValue;
+}
+
+size_t Preferences::putInt(const char *key, int32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+int32_t Preferences::getInt(const char *key, int32_t defaultValue) {
+  return getValue(*this, key, defaultValue);
+}
+size_t Preferences::putUInt(const char *key, uint32_t value) {
+  return putBytes(key, &value, sizeof(value));
+}
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue) {
+  return getValue(*this, key, defaultValue);
+}
+size_t Preferences::putBool(const char *key, bool value) {
+  uint8_t v = value;
+  return putBytes(key, &v, 1);
+}
+bool Preferences::getBool(const char *key, bool defaultValue) {
+  return getValue<uint8_t>(*this, key, defaultValue) != 0;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Arduino.h>
+
+// NVS Preferences kept in process memory (native env): namespaces survive
+// begin()/end() for the lifetime of the program, not across runs.
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false);
+  void end();
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putBytes(const char *key, const void *value, size_t len);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+  size_t putString(const char *key, const String &value);
+  String getString(const char *key, const String &defaultValue = String());
+
+  size_t putInt(const char *key, int32_t value);
+  int32_t getInt(const char *key, int32_t defaultValue = 0);
+  size_t putUInt(const char *key, uint32_t value);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  size_t putBool(const char *key, bool value);
+  bool getBool(const char *key, bool defaultValue = false);
+
+private:
+  String ns;
+  bool open = false;
+  bool readOnly = false;
+};
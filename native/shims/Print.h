@@ -0,0 +1,63 @@
+#pragma once
+
+#include "WString.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define DEC 10
+#define HEX 16
+
+// Arduino Print (native env): the overload set the services log with
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t n) {
+    size_t done = 0;
+    while (done < n && write(buf[done]))
+      done++;
+    return done;
+  }
+  size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+
+  size_t print(const char *s) { return write(s); }
+  size_t print(const __FlashStringHelper *s) { return write((const char *)s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned int v, int base = DEC) { return print(String(v, base)); }
+  size_t print(long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(unsigned long v, int base = DEC) {
+    return print(String(v, base));
+  }
+  size_t print(long long v, int base = DEC) { return print(String(v, base)); }
+  size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &v) {
+    size_t n = print(v);
+    return n + println();
+  }
+  template <typename T> size_t println(const T &v, int format) {
+    size_t n = print(v, format);
+    return n + println();
+  }
+
+  __attribute__((format(printf, 2, 3))) size_t printf(const char *fmt, ...) {
+    char buf[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (len < 0)
+      return 0;
+    if ((size_t)len < sizeof(buf))
+      return write((const uint8_t *)buf, len);
+    std::string big(len + 1, '\0');
+    va_start(ap, fmt);
+    vsnprintf(&big[0], big.size(), fmt, ap);
+    va_end(ap);
+    return write((const uint8_t *)big.data(), len);
+  }
+};
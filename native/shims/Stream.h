@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Print.h"
+
+uint32_t millis();
+void yield();
+
+// Arduino Stream (native env): timed reads plus find()/findUntil(), which
+// the streaming forecast/stock parsers use to skip to their arrays
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual void flush() {}
+
+  void setTimeout(unsigned long ms) { _timeout = ms; }
+  unsigned long getTimeout() const { return _timeout; }
+
+  virtual size_t readBytes(char *buffer, size_t length) {
+    size_t n = 0;
+    while (n < length) {
+      int c = timedRead();
+      if (c < 0)
+        break;
+      buffer[n++] = (char)c;
+    }
+    return n;
+  }
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    return readBytes((char *)buffer, length);
+  }
+
+  String readStringUntil(char terminator) {
+    String s;
+    int c;
+    while ((c = timedRead()) >= 0 && c != terminator)
+      s += (char)c;
+    return s;
+  }
+
+  bool find(const char *target) { return findUntil(target, nullptr); }
+
+  // True once target was read; false on timeout or when terminator came first
+  bool findUntil(const char *target, const char *terminator) {
+    size_t tLen = strlen(target);
+    size_t eLen = terminator ? strlen(terminator) : 0;
+    size_t t = 0, e = 0;
+    if (tLen == 0)
+      return true;
+    int c;
+    while ((c = timedRead()) >= 0) {
+      if (c == target[t]) {
+        if (++t == tLen)
+          return true;
+      } else {
+        t = (c == target[0]) ? 1 : 0;
+      }
+      if (eLen) {
+        if (c == terminator[e]) {
+          if (++e == eLen)
+            return false;
+        } else {
+          e = (c == terminator[0]) ? 1 : 0;
+        }
+      }
+    }
+    return false;
+  }
+
+protected:
+  unsigned long _timeout = 1000;
+
+  int timedRead() {
+    uint32_t start = millis();
+    do {
+      int c = read();
+      if (c >= 0)
+        return c;
+      yield();
+    } while (millis() - start < _timeout);
+    return -1;
+  }
+};
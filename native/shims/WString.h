@@ -0,0 +1,250 @@
+#pragma once
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+class __FlashStringHelper;
+
+// Arduino String on top of std::string (native env). Covers the members the
+// services and ArduinoJson use; String(float) keeps the Arduino default of
+// two decimals so URLs match the device byte for byte.
+class String {
+public:
+  String() {}
+  String(const char *s) : s(s ? s : "") {}
+  String(const char *s, size_t n) : s(s ? s : "", s ? n : 0) {}
+  String(const __FlashStringHelper *s) : String((const char *)s) {}
+  String(const std::string &s) : s(s) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(unsigned char v, unsigned char base = 10) { fromU(v, base); }
+  explicit String(int v, unsigned char base = 10) { fromS(v, base); }
+  explicit String(unsigned int v, unsigned char base = 10) { fromU(v, base); }
+  explicit String(long v, unsigned char base = 10) { fromS(v, base); }
+  explicit String(unsigned long v, unsigned char base = 10) {
+    fromU(v, base);
+  }
+  explicit String(long long v, unsigned char base = 10) { fromS(v, base); }
+  explicit String(unsigned long long v, unsigned char base = 10) {
+    fromU(v, base);
+  }
+  explicit String(float v, unsigned int decimals = 2) { fromF(v, decimals); }
+  explicit String(double v, unsigned int decimals = 2) { fromF(v, decimals); }
+
+  String &operator=(const char *c) {
+    s = c ? c : "";
+    return *this;
+  }
+
+  const char *c_str() const { return s.c_str(); }
+  unsigned int length() const { return s.length(); }
+  bool isEmpty() const { return s.empty(); }
+  void reserve(unsigned int n) { s.reserve(n); }
+
+  char charAt(unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  void setCharAt(unsigned int i, char c) {
+    if (i < s.size())
+      s[i] = c;
+  }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return s[i]; }
+
+  bool concat(const String &o) {
+    s += o.s;
+    return true;
+  }
+  bool concat(const char *c) {
+    if (!c)
+      return false;
+    s += c;
+    return true;
+  }
+  bool concat(const char *c, unsigned int n) {
+    if (!c)
+      return false;
+    s.append(c, n);
+    return true;
+  }
+  bool concat(char c) {
+    s += c;
+    return true;
+  }
+  template <typename T,
+            typename = typename std::enable_if<std::is_arithmetic<T>::value &&
+                                               !std::is_same<T, char>::value>::type>
+  bool concat(T v) {
+    return concat(String(v));
+  }
+  template <typename T> String &operator+=(const T &v) {
+    concat(v);
+    return *this;
+  }
+
+  bool equals(const String &o) const { return s == o.s; }
+  bool equalsIgnoreCase(const String &o) const {
+    return s.size() == o.s.size() && strcasecmp(c_str(), o.c_str()) == 0;
+  }
+  bool startsWith(const String &p) const { return s.rfind(p.s, 0) == 0; }
+  bool endsWith(const String &p) const {
+    return s.size() >= p.s.size() &&
+           s.compare(s.size() - p.s.size(), p.s.size(), p.s) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return pos(s.find(c, from)); }
+  int indexOf(const String &t, unsigned int from = 0) const {
+    return pos(s.find(t.s, from));
+  }
+  int lastIndexOf(char c) const { return pos(s.rfind(c)); }
+  int lastIndexOf(const String &t) const { return pos(s.rfind(t.s)); }
+
+  String substring(unsigned int from) const {
+    return from < s.size() ? String(s.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to)
+      std::swap(from, to);
+    if (from >= s.size())
+      return String();
+    return String(s.substr(from, to - from));
+  }
+
+  void replace(const String &from, const String &to) {
+    if (from.s.empty())
+      return;
+    size_t at = 0;
+    while ((at = s.find(from.s, at)) != std::string::npos) {
+      s.replace(at, from.s.size(), to.s);
+      at += to.s.size();
+    }
+  }
+  void replace(char from, char to) {
+    for (char &c : s)
+      if (c == from)
+        c = to;
+  }
+  void remove(unsigned int index) {
+    if (index < s.size())
+      s.erase(index);
+  }
+  void remove(unsigned int index, unsigned int count) {
+    if (index < s.size())
+      s.erase(index, count);
+  }
+  void toLowerCase() {
+    for (char &c : s)
+      c = tolower((unsigned char)c);
+  }
+  void toUpperCase() {
+    for (char &c : s)
+      c = toupper((unsigned char)c);
+  }
+  void trim() {
+    size_t b = s.find_first_not_of(" \t\r\n\f\v");
+    if (b == std::string::npos) {
+      s.clear();
+      return;
+    }
+    size_t e = s.find_last_not_of(" \t\r\n\f\v");
+    s = s.substr(b, e - b + 1);
+  }
+
+  long toInt() const { return atol(c_str()); }
+  float toFloat() const { return atof(c_str()); }
+  double toDouble() const { return atof(c_str()); }
+
+  void getBytes(unsigned char *buf, unsigned int size,
+                unsigned int index = 0) const {
+    if (!size || !buf)
+      return;
+    size_t n = index < s.size() ? s.size() - index : 0;
+    if (n > size - 1)
+      n = size - 1;
+    memcpy(buf, s.data() + (n ? index : 0), n);
+    buf[n] = 0;
+  }
+  void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const {
+    getBytes((unsigned char *)buf, size, index);
+  }
+
+  bool operator==(const String &o) const { return s == o.s; }
+  bool operator==(const char *c) const { return s == (c ? c : ""); }
+  bool operator!=(const String &o) const { return s != o.s; }
+  bool operator!=(const char *c) const { return !(*this == c); }
+  bool operator<(const String &o) const { return s < o.s; }
+  bool operator>(const String &o) const { return s > o.s; }
+
+private:
+  std::string s;
+
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+
+  void fromU(unsigned long long v, unsigned char base) {
+    char buf[72];
+    char *p = buf + sizeof(buf) - 1;
+    *p = 0;
+    if (base < 2)
+      base = 10;
+    do {
+      int d = v % base;
+      *--p = d < 10 ? '0' + d : 'a' + d - 10;
+      v /= base;
+    } while (v);
+    s = p;
+  }
+  void fromS(long long v, unsigned char base) {
+    if (v < 0 && base == 10) {
+      fromU(0ULL - (unsigned long long)v, base);
+      s.insert(s.begin(), '-');
+    } else {
+      fromU((unsigned long long)v, base);
+    }
+  }
+  void fromF(double v, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s = buf;
+  }
+};
+
+// Result type of operator+ (ArduinoJson adapts it like String)
+class StringSumHelper : public String {
+public:
+  StringSumHelper(const String &s) : String(s) {}
+  StringSumHelper(const char *s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String &a, const String &b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const String &a, const char *b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const char *a, const String &b) {
+  StringSumHelper r(a);
+  r.concat(b);
+  return r;
+}
+inline StringSumHelper operator+(const String &a, char c) {
+  StringSumHelper r(a);
+  r.concat(c);
+  return r;
+}
+template <typename T,
+          typename = typename std::enable_if<std::is_arithmetic<T>::value &&
+                                             !std::is_same<T, char>::value>::type>
+inline StringSumHelper operator+(const String &a, T v) {
+  StringSumHelper r(a);
+  r.concat(v);
+  return r;
+}
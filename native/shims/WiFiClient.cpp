@@ -0,0 +1,139 @@
+#include <WiFiClient.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+bool WiFiClient::waitFd(bool forWrite, uint32_t timeoutMs) {
+  struct pollfd p = {fd, (short)(forWrite ? POLLOUT : POLLIN), 0};
+  return poll(&p, 1, timeoutMs) > 0;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+  stop();
+  struct addrinfo hints = {}, *res = nullptr;
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  char service[8];
+  snprintf(service, sizeof(service), "%u", port);
+  if (getaddrinfo(host, service, &hints, &res) != 0 || !res)
+    return 0;
+
+  for (struct addrinfo *ai = res; ai && fd < 0; ai = ai->ai_next) {
+    fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+    if (fd < 0)
+      continue;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    int ok = ::connect(fd, ai->ai_addr, ai->ai_addrlen);
+    if (ok < 0 && errno == EINPROGRESS && waitFd(true, timeoutMs)) {
+      int err = 0;
+      socklen_t len = sizeof(err);
+      getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len);
+      ok = err ? -1 : 0;
+    }
+    if (ok < 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(res);
+  if (fd < 0)
+    return 0;
+
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  eof = false;
+  rxPos = rxLen = 0;
+  if (!handshake(host, timeoutMs)) {
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+void WiFiClient::stop() {
+  if (fd >= 0)
+    close(fd);
+  fd = -1;
+  eof = true;
+  rxPos = rxLen = 0;
+}
+
+ssize_t WiFiClient::recvSome(uint8_t *buf, size_t n) {
+  ssize_t r = recv(fd, buf, n, 0);
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return -2;
+  return r;
+}
+
+ssize_t WiFiClient::sendSome(const uint8_t *buf, size_t n) {
+  ssize_t r = send(fd, buf, n, MSG_NOSIGNAL);
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return -2;
+  return r;
+}
+
+bool WiFiClient::fill() {
+  if (rxPos < rxLen)
+    return true;
+  if (fd < 0 || eof)
+    return false;
+  ssize_t n = recvSome(rx, sizeof(rx));
+  if (n > 0) {
+    rxPos = 0;
+    rxLen = n;
+    return true;
+  }
+  if (n != -2)
+    eof = true; // Peer closed or socket error
+  return false;
+}
+
+uint8_t WiFiClient::connected() {
+  if (fd < 0)
+    return 0;
+  fill(); // Notices a peer that closed an idle keep-alive socket
+  return rxPos < rxLen || !eof;
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t n) {
+  size_t done = 0;
+  while (fd >= 0 && done < n) {
+    ssize_t r = sendSome(buf + done, n - done);
+    if (r == -2) {
+      if (!waitFd(true, 5000))
+        break;
+      continue;
+    }
+    if (r <= 0)
+      break;
+    done += r;
+  }
+  return done;
+}
+
+int WiFiClient::available() { return fill() ? (int)(rxLen - rxPos) : 0; }
+
+int WiFiClient::read() {
+  if (!fill())
+    return -1;
+  return rx[rxPos++];
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size) {
+  if (!fill())
+    return -1;
+  size_t n = rxLen - rxPos;
+  if (n > size)
+    n = size;
+  memcpy(buf, rx + rxPos, n);
+  rxPos += n;
+  return n;
+}
+
+int WiFiClient::peek() { return fill() ? rx[rxPos] : -1; }
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <sys/types.h>
+
+// Plain TCP client over a non-blocking POSIX socket (native env).
+// available()/read() never block, like lwIP on the device; a receive buffer
+// of WIFI_CLIENT_RX_BUFFER bytes sits between the socket and the caller.
+#ifndef WIFI_CLIENT_RX_BUFFER
+#define WIFI_CLIENT_RX_BUFFER 1436 // One TCP segment
+#endif
+
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  virtual ~WiFiClient() { stop(); }
+  WiFiClient(const WiFiClient &) = delete;
+  WiFiClient &operator=(const WiFiClient &) = delete;
+
+  int connect(const char *host, uint16_t port, int32_t timeoutMs = 5000);
+  virtual void stop();
+  uint8_t connected(); // True while data is buffered or the peer is open
+  operator bool() { return connected(); }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t n) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size);
+  int peek() override;
+  void flush() override {}
+
+protected:
+  int fd = -1;
+  bool eof = false;
+
+  // Transport hooks (TLS overrides them). recvSome: >0 bytes, 0 peer
+  // closed, -1 error, -2 nothing available right now.
+  virtual bool handshake(const char *host, uint32_t timeoutMs) {
+    (void)host;
+    (void)timeoutMs;
+    return true;
+  }
+  virtual ssize_t recvSome(uint8_t *buf, size_t n);
+  virtual ssize_t sendSome(const uint8_t *buf, size_t n);
+  bool waitFd(bool forWrite, uint32_t timeoutMs);
+
+private:
+  uint8_t rx[WIFI_CLIENT_RX_BUFFER];
+  size_t rxPos = 0, rxLen = 0;
+
+  bool fill(); // Non-blocking refill of rx
+};
@@ -0,0 +1,86 @@
+#include <WiFiClientSecure.h>
+
+#include <errno.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <unistd.h>
+
+static SSL_CTX *sslContext(bool verify) {
+  static SSL_CTX *ctx[2] = {nullptr, nullptr};
+  SSL_CTX *&c = ctx[verify ? 1 : 0];
+  if (!c) {
+    c = SSL_CTX_new(TLS_client_method());
+    if (verify) {
+      SSL_CTX_set_default_verify_paths(c);
+      SSL_CTX_set_verify(c, SSL_VERIFY_PEER, nullptr);
+    } else {
+      SSL_CTX_set_verify(c, SSL_VERIFY_NONE, nullptr);
+    }
+  }
+  return c;
+}
+
+bool WiFiClientSecure::handshake(const char *host, uint32_t timeoutMs) {
+  ssl = SSL_new(sslContext(!insecure));
+  if (!ssl)
+    return false;
+  SSL_set_fd(ssl, fd);
+  SSL_set_tlsext_host_name(ssl, host); // SNI
+  if (!insecure)
+    SSL_set1_host(ssl, host);
+
+  uint32_t start = millis();
+  while (true) {
+    int r = SSL_connect(ssl);
+    if (r == 1)
+      return true;
+    int err = SSL_get_error(ssl, r);
+    uint32_t spent = millis() - start;
+    if (spent >= timeoutMs ||
+        (err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE)) {
+      Serial.printf("TLS: Handshake with %s failed (%d)\n", host, err);
+      return false;
+    }
+    waitFd(err == SSL_ERROR_WANT_WRITE, timeoutMs - spent);
+  }
+}
+
+void WiFiClientSecure::stop() {
+  if (ssl) {
+    if (fd >= 0)
+      SSL_shutdown(ssl);
+    SSL_free(ssl);
+    ssl = nullptr;
+  }
+  WiFiClient::stop();
+}
+
+ssize_t WiFiClientSecure::recvSome(uint8_t *buf, size_t n) {
+  if (!ssl)
+    return -1;
+  int r = SSL_read(ssl, buf, n);
+  if (r > 0)
+    return r;
+  switch (SSL_get_error(ssl, r)) {
+  case SSL_ERROR_WANT_READ:
+  case SSL_ERROR_WANT_WRITE:
+    return -2;
+  case SSL_ERROR_ZERO_RETURN:
+    return 0;
+  default:
+    ERR_clear_error();
+    return -1;
+  }
+}
+
+ssize_t WiFiClientSecure::sendSome(const uint8_t *buf, size_t n) {
+  if (!ssl)
+    return -1;
+  int r = SSL_write(ssl, buf, n);
+  if (r > 0)
+    return r;
+  int err = SSL_get_error(ssl, r);
+  if (err == SSL_ERROR_WANT_READ || err == SSL_ERROR_WANT_WRITE)
+    return -2;
+  return -1;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <WiFiClient.h>
+
+typedef struct ssl_st SSL;
+
+// TLS client on OpenSSL (native env). setInsecure() skips certificate
+// verification, as on the device; otherwise the system CA store is used.
+class WiFiClientSecure : public WiFiClient {
+public:
+  ~WiFiClientSecure() override { stop(); }
+  void setInsecure() { insecure = true; }
+  void stop() override;
+
+protected:
+  bool handshake(const char *host, uint32_t timeoutMs) override;
+  ssize_t recvSome(uint8_t *buf, size_t n) override;
+  ssize_t sendSome(const uint8_t *buf, size_t n) override;
+
+private:
+  SSL *ssl = nullptr;
+  bool insecure = false;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+
+// No watchdog on the host
+typedef int esp_err_t;
+#define ESP_OK 0
+
+inline esp_err_t esp_task_wdt_init(uint32_t timeoutS, bool panic) {
+  (void)timeoutS;
+  (void)panic;
+  return ESP_OK;
+}
+inline esp_err_t esp_task_wdt_add(TaskHandle_t task) {
+  (void)task;
+  return ESP_OK;
+}
+inline esp_err_t esp_task_wdt_delete(TaskHandle_t task) {
+  (void)task;
+  return ESP_OK;
+}
+inline esp_err_t esp_task_wdt_reset() { return ESP_OK; }
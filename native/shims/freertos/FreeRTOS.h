@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// FreeRTOS subset on std::thread (native env): tasks, task notifications,
+// queues and semaphores. One tick is one millisecond; priorities and core
+// affinity are accepted and ignored.
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define errQUEUE_FULL 0
+#define tskNO_AFFINITY 0x7fffffff
+
+#define portYIELD_FROM_ISR(x) ((void)(x))
+
+struct NativeTask;
+typedef NativeTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+struct NativeQueue;
+typedef NativeQueue *QueueHandle_t;
+typedef NativeQueue *SemaphoreHandle_t;
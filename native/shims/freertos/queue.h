@@ -0,0 +1,18 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Fixed-size item queues (items are copied, as in FreeRTOS)
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+void vQueueDelete(QueueHandle_t q);
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+
+#define xQueueSendToBack xQueueSend
+inline BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item,
+                                    BaseType_t *woken) {
+  if (woken)
+    *woken = pdFALSE;
+  return xQueueSend(q, item, 0);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "queue.h"
+
+// Semaphores are zero-size queues, as in FreeRTOS itself (not recursive,
+// no priority inheritance)
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xQueueCreate(1, 0);
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t s = xQueueCreate(1, 0);
+  xQueueSend(s, nullptr, 0);
+  return s;
+}
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  return xQueueReceive(s, nullptr, ticks);
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  return xQueueSend(s, nullptr, 0);
+}
+#define vSemaphoreDelete vQueueDelete
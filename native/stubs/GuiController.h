@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Host stand-in for lib/GuiController (native env): the state and calls the
+// network task uses, without LVGL. wake() releases waitWake() in the native
+// driver, which plays the GUI task's role of draining DataManager events.
+class GuiController {
+public:
+  static void wake();
+  static bool waitWake(uint32_t timeoutMs); // native/main.cpp
+  static void showLoadingScreen(const char *msg = nullptr);
+
+  enum AppMode { APP_WEATHER, APP_STOCK, APP_BUS };
+  static AppMode currentApp;
+
+  static int currentBusIndex;
+  static int busStopCount;
+  static bool busStationChanged;
+  static int getBusIndex();
+  static bool isBusBoard();
+  static void setBusStopCount(int count);
+  static bool hasBusStationChanged();
+  static void clearBusStationChanged();
+
+  static int currentCityIndex;
+  static int cityCount;
+  static bool cityChanged;
+  static int getCityIndex();
+  static void setCityCount(int count);
+  static bool hasCityChanged();
+  static void clearCityChanged();
+};
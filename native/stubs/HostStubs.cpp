@@ -0,0 +1,93 @@
+#include "GuiController.h"
+#include "NetworkManager.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// --- GuiController ---
+
+GuiController::AppMode GuiController::currentApp = GuiController::APP_WEATHER;
+int GuiController::currentBusIndex = 0;
+int GuiController::busStopCount = 0;
+bool GuiController::busStationChanged = false;
+int GuiController::currentCityIndex = 0;
+int GuiController::cityCount = 0;
+bool GuiController::cityChanged = false;
+
+static std::mutex wakeMutex;
+static std::condition_variable wakeCv;
+static bool wakePending = false;
+
+void GuiController::wake() {
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex);
+    wakePending = true;
+  }
+  wakeCv.notify_one();
+}
+
+bool GuiController::waitWake(uint32_t timeoutMs) {
+  std::unique_lock<std::mutex> lock(wakeMutex);
+  bool woken = wakeCv.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                               [] { return wakePending; });
+  wakePending = false;
+  return woken;
+}
+
+void GuiController::showLoadingScreen(const char *msg) {
+  Serial.printf("GUI: Loading screen \"%s\"\n", msg ? msg : "");
+}
+
+int GuiController::getBusIndex() { return currentBusIndex; }
+bool GuiController::isBusBoard() { return false; }
+void GuiController::setBusStopCount(int count) { busStopCount = count; }
+bool GuiController::hasBusStationChanged() { return busStationChanged; }
+void GuiController::clearBusStationChanged() { busStationChanged = false; }
+
+int GuiController::getCityIndex() { return currentCityIndex; }
+void GuiController::setCityCount(int count) { cityCount = count; }
+bool GuiController::hasCityChanged() { return cityChanged; }
+void GuiController::clearCityChanged() { cityChanged = false; }
+
+// --- NetworkManager ---
+
+String NetworkManager::cities;
+String NetworkManager::busStops;
+String NetworkManager::appId;
+String NetworkManager::appKey;
+String NetworkManager::owmApiKey;
+String NetworkManager::stockSymbols;
+
+static String envOr(const char *name, const char *fallback) {
+  const char *v = getenv(name);
+  return String(v ? v : fallback);
+}
+
+void NetworkManager::loadConfig() {
+  cities = envOr("WEATHER_CITIES", "Barcelona");
+  busStops = envOr("BUS_STOPS", "");
+  appId = envOr("TMB_APP_ID", "");
+  appKey = envOr("TMB_APP_KEY", "");
+  owmApiKey = envOr("OWM_API_KEY", "");
+  stockSymbols = envOr("STOCK_SYMBOLS", "");
+  Serial.printf("NETWORK: Host config: cities \"%s\", stops \"%s\", "
+                "stocks \"%s\"\n",
+                cities.c_str(), busStops.c_str(), stockSymbols.c_str());
+}
+
+std::vector<String> NetworkManager::split(const String &list) {
+  std::vector<String> out;
+  int start = 0;
+  while (start < (int)list.length() && out.size() < 5) { // Device limit
+    int comma = list.indexOf(',', start);
+    if (comma < 0)
+      comma = list.length();
+    String item = list.substring(start, comma);
+    item.trim();
+    if (!item.isEmpty())
+      out.push_back(item);
+    start = comma + 1;
+  }
+  return out;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "WeatherService.h"
+#include <Arduino.h>
+
+// Host stand-in for lib/LedController (native env): no LED, no-op
+class LedController {
+public:
+  static void begin() {}
+  static void update(const WeatherData &data) { (void)data; }
+  static void setRGB(uint8_t r, uint8_t g, uint8_t b) {
+    (void)r;
+    (void)g;
+    (void)b;
+  }
+};
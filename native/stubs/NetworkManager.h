@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <vector>
+
+// Host stand-in for lib/NetworkManager (native env). Settings come from
+// environment variables instead of NVS and the web UI:
+//   WEATHER_CITIES  "Barcelona,Girona"  (default "Barcelona")
+//   BUS_STOPS       "2543,1265"
+//   OWM_API_KEY, TMB_APP_ID, TMB_APP_KEY, STOCK_SYMBOLS "AAPL,MSFT"
+class NetworkManager {
+public:
+  static void begin() {} // The host network is already up
+  static void loadConfig();
+  static void handleClient() {}
+
+  static String getAppId() { return appId; }
+  static String getAppKey() { return appKey; }
+  static String getOwmApiKey() { return owmApiKey; }
+  static String getStockSymbols() { return stockSymbols; }
+  static String getTimezone() { return "UTC0"; }
+  static bool getNightModeEnabled() { return false; }
+
+  static std::vector<String> getBusStops() { return split(busStops); }
+  static std::vector<String> getCities() { return split(cities); }
+
+  static bool isConnected() { return WiFi.status() == WL_CONNECTED; }
+
+private:
+  static String cities;
+  static String busStops;
+  static String appId;
+  static String appKey;
+  static String owmApiKey;
+  static String stockSymbols;
+
+  static std::vector<String> split(const String &list);
+};
@@ -12,6 +12,9 @@
 TouchDrv touch;
 
 void my_touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
+  static TouchGesture held = GESTURE_NONE;
+  static bool scrolled = false;
+
   int16_t x, y;
   if (touch.read(&x, &y)) {
     data->state = LV_INDEV_STATE_PR;
@@ -20,6 +23,22 @@ void my_touch_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
   } else {
     data->state = LV_INDEV_STATE_REL;
   }
+
+  // Controller-decoded swipes/taps go to the GUI as discrete events, on
+  // release. The controller also reports a swipe for a drag that scrolled
+  // a list (LVGL raises no gesture then), so those are dropped.
+  lv_indev_t *indev = lv_indev_get_act(); // The one being read
+  if (indev && lv_indev_get_scroll_obj(indev))
+    scrolled = true;
+  TouchGesture g = touch.takeGesture();
+  if (g != GESTURE_NONE)
+    held = g;
+  if (data->state == LV_INDEV_STATE_REL) {
+    if (held != GESTURE_NONE)
+      GuiController::postGesture(held, scrolled);
+    held = GESTURE_NONE;
+    scrolled = false;
+  }
 }
 
 // Time-Based Backlight Helper (Could move to Ledger or DataManager, but fine
@@ -80,6 +99,11 @@ void setup() {
   indev_drv.type = LV_INDEV_TYPE_POINTER;
   indev_drv.read_cb = my_touch_read;
   lv_indev_drv_register(&indev_drv);
+  touch.setWakeCallback(GuiController::wakeFromTouchISR);
+
+  // --- GUI TASK ---
+  // From here on only the GUI task (core 1) touches LVGL
+  GuiController::begin();
 
   // --- DATA MANAGER INIT ---
   // Starts the background task for WiFi and Data Fetching
@@ -89,76 +113,27 @@ void setup() {
 }
 
 void loop() {
-  // --- GUI UPDATE ---
-  GuiController::update();
-
-  // --- DATA SYNC ---
-  // We poll DataManager for thread-safe updates
-
-  // 1. Weather Update
-  WeatherData wd;
-  if (DataManager::getWeatherData(wd)) {
-    // If we are getting the first update, show it
-    GuiController::showWeatherScreen(wd, 0);
-  }
-
-  // 2. Bus Update
-  BusData bd;
-  bool busUpdated = false;
-  if (DataManager::getBusData(bd)) {
-    GuiController::updateBusCache(bd);
-    if (GuiController::isBusScreenActive()) {
-      GuiController::showBusScreen(bd, 0);
-      busUpdated = true;
-    }
-  }
-
-  // 3. Stock Update
-  std::vector<StockItem> sd;
-  if (DataManager::getStockData(sd)) {
-    GuiController::updateStockCache(sd);
-    if (GuiController::isStockScreenActive()) {
-      GuiController::showStockScreen(sd, 0);
-    }
-  }
-
-  // 4. Status Change Updates (Repaint for Yellow Dot)
-  if (!busUpdated && DataManager::getBusStatusChanged() &&
-      GuiController::isBusScreenActive()) {
-    // Refresh with current cache (don't consume new data flag if not set)
-    GuiController::showBusScreen(DataManager::getCurrentBusData(), 0);
-  }
-  if (DataManager::getWeatherStatusChanged()) {
-    // We stick to the currently displayed city index in GuiController logic
-    // But WeatherView needs to know which one. GuiController handles the
-    // mapping. Simplifying: Just refresh if active. Note: Checking specific
-    // screen activation is complex for Weather (Forecast vs Current) For now,
-    // just call update logic? No, update() doesn't redraw. Let's leave Weather
-    // for now if user didn't explicitly complain, but good to add. Actually,
-    // `showWeatherScreen` takes WeatherData. We need to know IF weather screen
-    // is active. GuiController doesn't expose `isWeatherScreenActive` clearly
-    // (it has AppMode).
-    if (GuiController::currentApp == GuiController::APP_WEATHER) {
-      GuiController::showWeatherScreen(DataManager::getCurrentWeatherData(), 0);
-    }
+  // Screens, data events and the clock are handled by the GUI task; the
+  // Arduino loop only keeps the slow housekeeping.
+
+  // Debug: 'e' dumps the event trace, 't' the touch I2C rates, 'n' the
+  // network and snapshot stats
+  if (Serial.available()) {
+    char c = Serial.read();
+    if (c == 'e')
+      DataManager::dumpEventTrace();
+    else if (c == 't')
+      touch.printStats();
+    else if (c == 'n')
+      DataManager::printNetStats();
   }
 
-  // --- APP STATE TRIGGERS ---
-
-  // Detect App Switching (Force Update on Entry)
-  static bool wasBusActive = false;
-  bool isBus = GuiController::isBusScreenActive();
-  if (isBus && !wasBusActive) {
-    Serial.println("MAIN: Switched to Bus App -> Forcing Update");
-    DataManager::triggerBusUpdate();
-  }
-  wasBusActive = isBus;
-
-  // Clock & Backlight
-  static uint32_t lastTimeUpdate = 0;
-  if (millis() - lastTimeUpdate > 10000) {
-    lastTimeUpdate = millis();
-    GuiController::updateTime();
+  // Backlight
+  static uint32_t lastBacklightCheck = 0;
+  if (millis() - lastBacklightCheck > 10000) {
+    lastBacklightCheck = millis();
     updateBacklight();
   }
+
+  delay(50); // Let the core idle between checks
 }
@@ -0,0 +1,114 @@
+// Host test for the merged departures board: pio test -e native_test
+#include "DepartureBoard.h"
+#include <unity.h>
+
+static BusData stop(const char *code, uint32_t lastUpdate,
+                    std::vector<int> seconds) {
+  BusData d;
+  d.stopCode = code;
+  d.lastUpdate = lastUpdate;
+  for (int s : seconds) {
+    BusArrival a;
+    a.line = "V15";
+    a.seconds = s;
+    d.arrivals.push_back(a);
+  }
+  return d;
+}
+
+static void assertSorted(const DepartureBoard &board) {
+  const std::vector<BusArrival> &all = board.data().arrivals;
+  for (size_t i = 1; i < all.size(); i++)
+    TEST_ASSERT_TRUE(all[i - 1].seconds <= all[i].seconds);
+}
+
+static void assertArrival(const BusArrival &a, int stop, int seconds) {
+  TEST_ASSERT_EQUAL_INT(stop, a.stop);
+  TEST_ASSERT_EQUAL_INT(seconds, a.seconds);
+}
+
+void setUp() {}
+void tearDown() {}
+
+// Heads from every stop, relative to the board base
+void test_rebuild_merges_by_due_time() {
+  BusData a = stop("1", 10000, {30, 200, 600});
+  BusData b = stop("2", 12000, {10, 100});
+  const BusData *stops[] = {&a, &b, NULL};
+  DepartureBoard board;
+  board.rebuild(stops, 3, 13000);
+
+  const std::vector<BusArrival> &all = board.data().arrivals;
+  TEST_ASSERT_EQUAL_UINT32(13000, board.data().lastUpdate);
+  TEST_ASSERT_EQUAL_INT(5, (int)all.size());
+  assertArrival(all[0], 1, 9);
+  assertArrival(all[1], 0, 27);
+  assertSorted(board);
+  TEST_ASSERT_EQUAL_INT(3, board.stopCount());
+  TEST_ASSERT_FALSE(board.hasStop(2));
+  TEST_ASSERT_EQUAL_UINT32(10000, board.oldestUpdate());
+}
+
+// A stop refresh replaces only that stop's arrivals
+void test_update_stop_matches_rebuild() {
+  BusData a = stop("1", 10000, {30, 200, 600});
+  BusData b = stop("2", 10000, {10, 100});
+  BusData b2 = stop("2", 10000, {5, 40, 900});
+  const BusData *before[] = {&a, &b};
+  const BusData *after[] = {&a, &b2};
+  DepartureBoard updated, rebuilt;
+  updated.rebuild(before, 2, 10000);
+  updated.updateStop(1, b2, 10000);
+  rebuilt.rebuild(after, 2, 10000);
+
+  const std::vector<BusArrival> &u = updated.data().arrivals;
+  const std::vector<BusArrival> &r = rebuilt.data().arrivals;
+  TEST_ASSERT_EQUAL_INT((int)r.size(), (int)u.size());
+  for (size_t i = 0; i < r.size(); i++)
+    assertArrival(u[i], r[i].stop, r[i].seconds);
+}
+
+// The base moves in whole seconds and everyone else counts down with it
+void test_update_stop_rebases() {
+  BusData a = stop("1", 10000, {30});
+  const BusData *stops[] = {&a};
+  DepartureBoard board;
+  board.rebuild(stops, 1, 10000);
+  board.updateStop(1, stop("2", 12500, {10}), 12500);
+
+  const std::vector<BusArrival> &all = board.data().arrivals;
+  TEST_ASSERT_EQUAL_UINT32(12000, board.data().lastUpdate);
+  assertArrival(all[0], 1, 10);
+  assertArrival(all[1], 0, 28);
+  TEST_ASSERT_EQUAL_INT(2, board.stopCount());
+}
+
+// Flash data (lastUpdate 0) counts down from the merge
+void test_flash_stop() {
+  DepartureBoard board;
+  board.updateStop(0, stop("1", 0, {50}), 14000);
+  assertArrival(board.data().arrivals[0], 0, 50);
+  TEST_ASSERT_EQUAL_UINT32(0, board.oldestUpdate());
+}
+
+void test_empty_stop_drops_arrivals() {
+  BusData a = stop("1", 10000, {30, 200});
+  BusData b = stop("2", 10000, {10});
+  const BusData *stops[] = {&a, &b};
+  DepartureBoard board;
+  board.rebuild(stops, 2, 10000);
+  board.updateStop(0, stop("1", 10000, {}), 10000);
+
+  TEST_ASSERT_EQUAL_INT(1, (int)board.data().arrivals.size());
+  assertArrival(board.data().arrivals[0], 1, 10);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_rebuild_merges_by_due_time);
+  RUN_TEST(test_update_stop_matches_rebuild);
+  RUN_TEST(test_update_stop_rebases);
+  RUN_TEST(test_flash_stop);
+  RUN_TEST(test_empty_stop_drops_arrivals);
+  return UNITY_END();
+}
@@ -0,0 +1,81 @@
+# Subset fonts for names (stop names, destinations, cities).
+#
+# Regenerates lib/GuiController/font_names_14.c and font_names_20.c from the
+# Montserrat-Medium.ttf bundled with LVGL, holding printable ASCII plus the
+# accented glyphs our data uses (NAME_SYMBOLS, which must match the glyph
+# table in lib/Translit/Translit.cpp). Every non-ASCII codepoint found in
+# tools/payloads/tmb_names.txt is checked against that set.
+#
+# Builds don't run this script: commit its output and add -D NAME_FONTS to
+# build_flags to switch the name labels to these fonts (until then they use
+# the built-in ASCII Montserrat and names are folded). Rerun it by hand after
+# changing NAME_SYMBOLS, SIZES or BPP:
+#   python3 tools/font_subset.py [path/to/Montserrat-Medium.ttf]
+#   python3 tools/font_subset.py --check   (coverage check only)
+# Needs Node.js (lv_font_conv is fetched with npx).
+
+import os
+import subprocess
+import sys
+
+LV_FONT_CONV = "lv_font_conv@1.5.2"
+SIZES = [14, 20]
+BPP = 4
+# Catalan / Spanish letters and the Catalan middle dot (l·l)
+NAME_SYMBOLS = "ÀÁÇÈÉÍÏÑÒÓÚÜàáçèéíïñòóúü·"
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+LIBDEPS_DIR = os.path.join(PROJECT_DIR, ".pio", "libdeps", "esp32-2432S024C")
+
+OUT_DIR = os.path.join(PROJECT_DIR, "lib", "GuiController")
+NAMES_FILE = os.path.join(PROJECT_DIR, "tools", "payloads", "tmb_names.txt")
+
+
+def find_ttf():
+    if len(sys.argv) > 1 and sys.argv[1].endswith(".ttf"):
+        return sys.argv[1]
+    return os.path.join(LIBDEPS_DIR, "lvgl", "scripts", "built_in_font",
+                        "Montserrat-Medium.ttf")
+
+
+def check_coverage():
+    if not os.path.exists(NAMES_FILE):
+        return True
+    missing = set()
+    with open(NAMES_FILE, encoding="utf-8") as f:
+        for line in f:
+            if line.startswith("#"):
+                continue
+            for ch in line.strip():
+                if ord(ch) > 0x7E and ch not in NAME_SYMBOLS:
+                    missing.add(ch)
+    if missing:
+        print("FONT: glyphs in %s not in NAME_SYMBOLS (shown folded): %s"
+              % (os.path.basename(NAMES_FILE), "".join(sorted(missing))))
+    return not missing
+
+
+def generate():
+    ttf = find_ttf()
+    if not os.path.exists(ttf):
+        sys.exit("FONT: %s not found (run 'pio pkg install' first or "
+                 "pass the TTF path)" % ttf)
+    for size in SIZES:
+        out = os.path.join(OUT_DIR, "font_names_%d.c" % size)
+        cmd = ["npx", "--yes", LV_FONT_CONV,
+               "--font", ttf, "-r", "0x20-0x7E", "--symbols", NAME_SYMBOLS,
+               "--size", str(size), "--bpp", str(BPP), "--format", "lvgl",
+               "--no-compress", "--lv-include", "lvgl.h", "-o", out]
+        print("FONT: generating %s" % os.path.relpath(out, PROJECT_DIR))
+        try:
+            subprocess.check_call(cmd)
+        except (OSError, subprocess.CalledProcessError) as e:
+            sys.exit("FONT: lv_font_conv failed (%s); Node.js/npx is required"
+                     % e)
+
+
+if __name__ == "__main__":
+    ok = check_coverage()
+    if "--check" in sys.argv:
+        sys.exit(0 if ok else 1)
+    generate()
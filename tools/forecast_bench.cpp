@@ -0,0 +1,258 @@
+// Host benchmark: OWM 5-day forecast parse, full document vs. streaming.
+//
+// Replays a recorded /data/2.5/forecast payload through
+//   a) the previous path: one filtered JsonDocument for the whole response,
+//      then an hourly pass and a daily pass over the "list" array
+//   b) the current path: "list" items deserialized one at a time and folded
+//      into ForecastAggregator (lib/WeatherService)
+// and reports parse time and peak JSON heap for each.
+//
+// Build (ArduinoJson 7 headers from .pio/libdeps or a checkout):
+//   g++ -std=gnu++11 -O2 -Ilib/WeatherService -I<ArduinoJson>/src
+//       -o forecast_bench tools/forecast_bench.cpp
+//       lib/WeatherService/ForecastAggregator.cpp
+//   ./forecast_bench tools/payloads/owm_forecast_barcelona.json [iterations]
+
+#define ARDUINOJSON_ENABLE_STD_STREAM 1
+#include <ArduinoJson.h>
+
+#include "ForecastAggregator.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Tracks live and peak bytes, like CountingAllocator in lib/NetStats
+class PeakAllocator : public ArduinoJson::Allocator {
+public:
+  size_t live = 0, peak = 0;
+
+  void *allocate(size_t size) override {
+    size_t *p = (size_t *)malloc(size + sizeof(size_t));
+    if (!p)
+      return nullptr;
+    *p = size;
+    grow(size);
+    return p + 1;
+  }
+  void deallocate(void *ptr) override {
+    if (!ptr)
+      return;
+    size_t *p = (size_t *)ptr - 1;
+    live -= *p;
+    free(p);
+  }
+  void *reallocate(void *ptr, size_t newSize) override {
+    size_t *p = (size_t *)ptr - 1;
+    size_t old = *p;
+    p = (size_t *)realloc(p, newSize + sizeof(size_t));
+    if (!p)
+      return nullptr;
+    *p = newSize;
+    live -= old;
+    grow(newSize);
+    return p + 1;
+  }
+
+private:
+  void grow(size_t n) {
+    live += n;
+    if (live > peak)
+      peak = live;
+  }
+};
+
+// Stream::find / Stream::findUntil equivalents for std::istream
+static bool streamFind(std::istream &in, const char *target) {
+  size_t len = strlen(target), matched = 0;
+  int c;
+  while ((c = in.get()) != EOF) {
+    if (c == target[matched]) {
+      if (++matched == len)
+        return true;
+    } else {
+      matched = (c == target[0]) ? 1 : 0;
+    }
+  }
+  return false;
+}
+
+static bool streamFindUntil(std::istream &in, char target, char terminator) {
+  int c;
+  while ((c = in.get()) != EOF) {
+    if (c == target)
+      return true;
+    if (c == terminator)
+      return false;
+  }
+  return false;
+}
+
+struct Result {
+  int hours, days;
+  float firstTemp, day0Max;
+  int day0Code;
+  size_t peakBytes;
+};
+
+// a) Previous implementation: whole filtered document, two passes
+static Result parseFullDoc(const std::string &payload) {
+  JsonDocument filter;
+  JsonObject f = filter["list"][0].to<JsonObject>();
+  f["main"]["temp"] = true;
+  f["weather"][0]["icon"] = true;
+  f["pop"] = true;
+  f["dt_txt"] = true;
+
+  PeakAllocator alloc;
+  Result r = {};
+  {
+    JsonDocument doc(&alloc);
+    std::istringstream in(payload);
+    if (deserializeJson(doc, in, DeserializationOption::Filter(filter)))
+      return r;
+
+    JsonArray list = doc["list"];
+    float hourlyTemp[24];
+    for (size_t i = 0; i < 24 && i < list.size(); i++) {
+      hourlyTemp[i] = list[i]["main"]["temp"];
+      r.hours++;
+    }
+    r.firstTemp = hourlyTemp[0];
+
+    // Daily pass, as in the old WeatherService loop (String substrings)
+    std::string currentDay;
+    float dayMax = -100;
+    int middayCode = 3, middayDiff = 9999;
+    for (JsonObject item : list) {
+      std::string dt = item["dt_txt"].as<const char *>();
+      std::string dayStr = dt.substr(0, 10);
+      int hour = atoi(dt.substr(11, 2).c_str());
+      if (currentDay.empty())
+        currentDay = dayStr;
+      if (dayStr != currentDay) {
+        if (r.days == 0) {
+          r.day0Max = dayMax;
+          r.day0Code = middayCode;
+        }
+        r.days++;
+        currentDay = dayStr;
+        dayMax = -100;
+        middayDiff = 9999;
+      }
+      float t = item["main"]["temp"];
+      if (t > dayMax)
+        dayMax = t;
+      int diff = abs(hour - 12);
+      if (diff < middayDiff) {
+        middayDiff = diff;
+        middayCode =
+            ForecastAggregator::iconToWmo(item["weather"][0]["icon"]);
+      }
+    }
+    if (!currentDay.empty())
+      r.days++;
+  }
+  r.peakBytes = alloc.peak;
+  if (r.days > ForecastAggregator::MAX_DAYS)
+    r.days = ForecastAggregator::MAX_DAYS;
+  return r;
+}
+
+// b) Current implementation: one list item at a time
+static Result parseStreaming(const std::string &payload,
+                             ForecastAggregator &agg) {
+  JsonDocument filter;
+  filter["dt"] = true;
+  filter["main"]["temp"] = true;
+  filter["weather"][0]["icon"] = true;
+  filter["pop"] = true;
+  filter["dt_txt"] = true;
+
+  Result r = {};
+  agg.reset();
+  std::istringstream in(payload);
+  if (streamFind(in, "\"list\":[")) {
+    do {
+      PeakAllocator alloc;
+      JsonDocument item(&alloc);
+      DeserializationError err =
+          deserializeJson(item, in, DeserializationOption::Filter(filter));
+      if (alloc.peak > r.peakBytes)
+        r.peakBytes = alloc.peak;
+      if (err)
+        break;
+      ForecastItem fi;
+      fi.dt = item["dt"];
+      fi.dtTxt = item["dt_txt"];
+      fi.icon = item["weather"][0]["icon"];
+      fi.temp = item["main"]["temp"];
+      fi.pop = item["pop"];
+      agg.add(fi);
+    } while (streamFindUntil(in, ',', ']'));
+  }
+  agg.finish();
+
+  r.hours = agg.hourCount;
+  r.days = agg.dayCount;
+  if (agg.hourCount > 0)
+    r.firstTemp = agg.hours[0].temp;
+  if (agg.dayCount > 0) {
+    r.day0Max = agg.days[0].maxTemp;
+    r.day0Code = agg.days[0].weatherCode;
+  }
+  return r;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <owm_forecast.json> [iterations]\n", argv[0]);
+    return 1;
+  }
+  std::ifstream file(argv[1], std::ios::binary);
+  if (!file) {
+    fprintf(stderr, "cannot open %s\n", argv[1]);
+    return 1;
+  }
+  std::stringstream ss;
+  ss << file.rdbuf();
+  std::string payload = ss.str();
+  int iterations = argc > 2 ? atoi(argv[2]) : 200;
+
+  typedef std::chrono::steady_clock Clock;
+  ForecastAggregator agg;
+  Result full = {}, stream = {};
+
+  Clock::time_point t0 = Clock::now();
+  for (int i = 0; i < iterations; i++)
+    full = parseFullDoc(payload);
+  Clock::time_point t1 = Clock::now();
+  for (int i = 0; i < iterations; i++)
+    stream = parseStreaming(payload, agg);
+  Clock::time_point t2 = Clock::now();
+
+  double fullUs =
+      std::chrono::duration<double, std::micro>(t1 - t0).count() / iterations;
+  double streamUs =
+      std::chrono::duration<double, std::micro>(t2 - t1).count() / iterations;
+
+  printf("payload: %s (%zu bytes), %d iterations\n", argv[1], payload.size(),
+         iterations);
+  printf("%-10s %10s %10s %6s %5s\n", "path", "parse us", "peak B", "hours",
+         "days");
+  printf("%-10s %10.1f %10zu %6d %5d\n", "full-doc", fullUs, full.peakBytes,
+         full.hours, full.days);
+  printf("%-10s %10.1f %10zu %6d %5d\n", "streaming", streamUs,
+         stream.peakBytes, stream.hours, stream.days);
+
+  bool same = full.hours == stream.hours && full.days == stream.days &&
+              full.firstTemp == stream.firstTemp &&
+              full.day0Max == stream.day0Max &&
+              full.day0Code == stream.day0Code;
+  printf("results %s\n", same ? "match" : "DIFFER");
+  return same ? 0 : 2;
+}
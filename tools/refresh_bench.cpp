@@ -0,0 +1,193 @@
+// Host benchmark: full DataManager refresh cycles against the replay server.
+//
+// Runs the real network task (services, FetchScheduler, HttpPool, parsers)
+// from the native env, points every service at tools/replay_server.py and
+// reports, per cycle, wall time and peak process heap, then per endpoint
+// request count/errors, request time, body bytes and peak JSON document.
+//
+//   python3 tools/replay_server.py --latency-ms 80 --bandwidth 40000 &
+//   pio run -e native_bench
+//   .pio/build/native_bench/program [--base http://127.0.0.1:8080]
+//       [--cycles 5]
+//
+// Cycle 0 is a cold start (empty cache dir, geocoding included); later
+// cycles are DataManager::refreshAll() with warm pooled connections. Wall
+// time includes the scheduler's per-host spacing, so compare it between
+// runs rather than against the sum of request times. Settings default to
+// the replay payloads (Barcelona, stop 2775, AAPL/MSFT/BTC-USD) and can be
+// overridden with the env vars in native/stubs/NetworkManager.h.
+
+#include "BusService.h"
+#include "DataManager.h"
+#include "GuiController.h"
+#include "HttpPool.h"
+#include "NetStats.h"
+#include "StockService.h"
+#include "WeatherService.h"
+#include <Arduino.h>
+
+#include <atomic>
+#include <errno.h>
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+// --- Heap accounting: interpose the glibc allocator ---
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void *__libc_memalign(size_t, size_t);
+void __libc_free(void *);
+}
+
+static std::atomic<long> heapLive(0);
+static std::atomic<long> heapPeak(0);
+
+static void heapAdd(void *p) {
+  if (!p)
+    return;
+  long now = heapLive += (long)malloc_usable_size(p);
+  long peak = heapPeak.load();
+  while (now > peak && !heapPeak.compare_exchange_weak(peak, now))
+    ;
+}
+
+static void heapSub(void *p) {
+  if (p)
+    heapLive -= (long)malloc_usable_size(p);
+}
+
+extern "C" {
+void *malloc(size_t n) {
+  void *p = __libc_malloc(n);
+  heapAdd(p);
+  return p;
+}
+void *calloc(size_t n, size_t size) {
+  void *p = __libc_calloc(n, size);
+  heapAdd(p);
+  return p;
+}
+void *realloc(void *old, size_t n) {
+  heapSub(old);
+  void *p = __libc_realloc(old, n);
+  heapAdd(p ? p : (n ? old : nullptr)); // Failed realloc keeps the block
+  return p;
+}
+void *memalign(size_t align, size_t n) {
+  void *p = __libc_memalign(align, n);
+  heapAdd(p);
+  return p;
+}
+void *aligned_alloc(size_t align, size_t n) { return memalign(align, n); }
+int posix_memalign(void **out, size_t align, size_t n) {
+  *out = memalign(align, n);
+  return *out ? 0 : ENOMEM;
+}
+void free(void *p) {
+  heapSub(p);
+  __libc_free(p);
+}
+}
+
+// --- Bench ---
+static void drainEvents(uint32_t waitMs) {
+  GuiController::waitWake(waitMs);
+  DataEvent ev;
+  while (DataManager::pollEvent(ev))
+    ;
+}
+
+// Waits until `target` fetch jobs have completed; false on timeout
+static bool waitForJobs(uint32_t target, uint32_t timeoutMs) {
+  uint32_t start = millis();
+  while (DataManager::getCompletedJobs() < target) {
+    if (millis() - start > timeoutMs)
+      return false;
+    drainEvents(50);
+  }
+  return true;
+}
+
+static void printEndpoints(const char *title, int cycles) {
+  Serial.printf("\nBENCH: %s (%d cycle%s)\n", title, cycles,
+                cycles == 1 ? "" : "s");
+  Serial.printf("%-13s %5s %5s %8s %8s %9s %9s %9s\n", "endpoint", "reqs",
+                "errs", "avg ms", "max ms", "bytes", "B/s", "doc peak");
+  for (int i = 0; i < EP_COUNT; i++) {
+    const NetStats::Entry &e = NetStats::get((NetEndpoint)i);
+    if (!e.requests)
+      continue;
+    Serial.printf("%-13s %5u %5u %8u %8u %9u %9u %9u\n",
+                  NetStats::name((NetEndpoint)i), e.requests, e.errors,
+                  e.requestMs / e.requests, e.maxRequestMs, e.streamBytes,
+                  e.streamMs ? (unsigned)(e.streamBytes * 1000ULL / e.streamMs)
+                             : 0,
+                  (unsigned)e.maxDocBytes);
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *base = "http://127.0.0.1:8080";
+  int cycles = 5;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--base") && i + 1 < argc)
+      base = argv[++i];
+    else if (!strcmp(argv[i], "--cycles") && i + 1 < argc)
+      cycles = atoi(argv[++i]);
+  }
+
+  // Defaults match tools/payloads; keys are placeholders for the replay
+  setenv("WEATHER_CITIES", "Barcelona", 0);
+  setenv("BUS_STOPS", "2775", 0);
+  setenv("STOCK_SYMBOLS", "AAPL,MSFT,BTC-USD", 0);
+  setenv("OWM_API_KEY", "replay", 0);
+  setenv("TMB_APP_ID", "replay", 0);
+  setenv("TMB_APP_KEY", "replay", 0);
+  char fsDir[] = "/tmp/refresh_bench.XXXXXX"; // Cold CacheStore every run
+  if (!getenv("NATIVE_FS_DIR") && mkdtemp(fsDir))
+    setenv("NATIVE_FS_DIR", fsDir, 1);
+
+  Serial.begin(115200);
+  WeatherService::setBaseUrl(base);
+  BusService::setBaseUrl(base);
+  StockService::setBaseUrl(base);
+  Serial.printf("BENCH: %s, %d cycles\n", base, cycles);
+
+  NetStats::reset();
+  uint32_t target = 0;
+  for (int c = 0; c <= cycles; c++) {
+    if (c == 1) {
+      printEndpoints("cold start", 1);
+      NetStats::reset();
+    }
+    heapPeak.store(heapLive.load());
+    long heapStart = heapLive.load();
+    uint32_t start = millis();
+
+    if (c == 0) {
+      DataManager::begin();
+      while (DataManager::getJobCount() == 0)
+        drainEvents(10);
+    } else {
+      DataManager::refreshAll();
+    }
+    target += DataManager::getJobCount();
+    if (!waitForJobs(target, 120000)) {
+      Serial.printf("BENCH: cycle %d timed out (%u/%u jobs)\n", c,
+                    DataManager::getCompletedJobs(), target);
+      break;
+    }
+    Serial.printf("BENCH: cycle %d %6u ms, heap %ld -> peak %ld (+%ld) B\n", c,
+                  millis() - start, heapStart, heapPeak.load(),
+                  heapPeak.load() - heapStart);
+  }
+  if (cycles > 0)
+    printEndpoints("refreshAll", cycles);
+
+  Serial.println();
+  HttpPool::printStats();
+  Serial.flush();
+  quick_exit(0); // The network task never returns
+}
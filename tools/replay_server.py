@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+# Local stand-in for OWM, Open-Meteo, TMB and Yahoo: replays recorded
+# payloads so refresh latency can be measured without the real APIs.
+#
+# Capture format: a JSON manifest (default tools/payloads/replay.json)
+#   {"version": 1,
+#    "endpoints": [
+#      {"name": "owm_geo", "upstream": "https://api.openweathermap.org",
+#       "path": "/geo/1.0/direct", "file": "owm_geo_barcelona.json",
+#       "status": 200},
+#      ...]}
+# A request is served by the endpoint with the longest matching path
+# prefix (the query string is ignored); "file" is relative to the
+# manifest. Any network option below can also be set per endpoint
+# ("latency_ms", "bandwidth", "error_rate", "mode", "chunk_size").
+#
+# Point the firmware at it with -D REPLAY_BASE_URL=\"http://<host>:8080\"
+# or the services' setBaseUrl() (tools/refresh_bench.cpp does that).
+#
+#   python3 tools/replay_server.py [--port 8080] [--latency-ms 120]
+#       [--bandwidth 20000] [--error-rate 0.05] [--mode chunked]
+#   python3 tools/replay_server.py --record     # refresh the payloads
+#
+# --record forwards each request to the endpoint's upstream (keep the API
+# keys in the client's URLs) and overwrites its file with the response.
+
+import argparse
+import json
+import os
+import random
+import socketserver
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+from http.server import BaseHTTPRequestHandler
+
+DEFAULT_MANIFEST = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                "payloads", "replay.json")
+MODES = ("length", "chunked", "http10")
+ERRORS = ("503", "reset", "truncate")
+REASONS = {200: "OK", 401: "Unauthorized", 404: "Not Found",
+           429: "Too Many Requests", 503: "Service Unavailable"}
+
+
+class Replay:
+    def __init__(self, args):
+        self.args = args
+        self.base = os.path.dirname(os.path.abspath(args.manifest))
+        with open(args.manifest, encoding="utf-8") as f:
+            self.manifest = json.load(f)
+        self.endpoints = sorted(self.manifest["endpoints"],
+                                key=lambda e: len(e["path"]), reverse=True)
+        self.bodies = {}
+        self.rng = random.Random(args.seed)
+        self.lock = threading.Lock()
+        for ep in self.endpoints:
+            self.load(ep)
+
+    def load(self, ep):
+        path = os.path.join(self.base, ep["file"])
+        try:
+            with open(path, "rb") as f:
+                self.bodies[ep["name"]] = f.read()
+        except OSError:
+            self.bodies[ep["name"]] = b""
+            if not self.args.record:
+                print("REPLAY: %s missing (%s)" % (ep["name"], path),
+                      file=sys.stderr)
+
+    def match(self, path):
+        path = path.split("?", 1)[0]
+        for ep in self.endpoints:
+            if path.startswith(ep["path"]):
+                return ep
+        return None
+
+    def option(self, ep, key, default):
+        return ep.get(key, default) if ep else default
+
+    def roll_error(self, ep):
+        rate = self.option(ep, "error_rate", self.args.error_rate)
+        with self.lock:
+            if rate <= 0 or self.rng.random() >= rate:
+                return None
+            if self.args.error_kind != "mixed":
+                return self.args.error_kind
+            return self.rng.choice(ERRORS)
+
+    def record(self, ep, path):
+        url = ep["upstream"] + path
+        req = urllib.request.Request(url, headers={
+            "User-Agent": "Mozilla/5.0 (esp32)"})
+        try:
+            with urllib.request.urlopen(req, timeout=20) as resp:
+                status, body = resp.status, resp.read()
+        except urllib.error.HTTPError as e:
+            status, body = e.code, e.read()
+        with self.lock:
+            with open(os.path.join(self.base, ep["file"]), "wb") as f:
+                f.write(body)
+            self.bodies[ep["name"]] = body
+            ep["status"] = status
+            with open(self.args.manifest, "w", encoding="utf-8") as f:
+                json.dump(self.manifest, f, indent=2)
+                f.write("\n")
+        print("REPLAY: recorded %s %d (%d B)" % (ep["name"], status,
+                                                 len(body)), file=sys.stderr)
+        return status, body
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    replay = None  # Set in main()
+
+    def log_message(self, fmt, *args):
+        pass
+
+    def do_GET(self):
+        r = self.replay
+        start = time.monotonic()
+        ep = r.match(self.path)
+        if ep is None:
+            status, body = 404, b'{"error":"no recorded endpoint"}'
+        elif r.args.record:
+            status, body = r.record(ep, self.path)
+        else:
+            status, body = ep.get("status", 200), r.bodies[ep["name"]]
+
+        latency = r.option(ep, "latency_ms", r.args.latency_ms)
+        if latency > 0:
+            time.sleep(latency / 1000.0)
+
+        error = r.roll_error(ep) if not r.args.record else None
+        if error == "reset":
+            self.close_connection = True
+            self.log(ep, "reset", 0, start)
+            return
+        if error == "503":
+            status, body = 503, b'{"error":"replay injected"}'
+
+        mode = r.option(ep, "mode", r.args.mode)
+        sent = self.send_body(status, body, mode, ep,
+                              truncate=(error == "truncate"))
+        self.log(ep, error or status, sent, start)
+
+    def send_body(self, status, body, mode, ep, truncate=False):
+        r = self.replay
+        http10 = mode == "http10"
+        version = "HTTP/1.0" if http10 else "HTTP/1.1"
+        head = ["%s %d %s" % (version, status, REASONS.get(status, "Status")),
+                "Content-Type: application/json"]
+        if http10:
+            head.append("Connection: close")  # Close-delimited body
+            self.close_connection = True
+        elif mode == "chunked":
+            head.append("Transfer-Encoding: chunked")
+        else:
+            head.append("Content-Length: %d" % len(body))
+        self.wfile.write(("\r\n".join(head) + "\r\n\r\n").encode())
+
+        if truncate:
+            body = body[:len(body) // 2]
+            self.close_connection = True
+
+        if mode == "chunked" and not http10:
+            size = r.option(ep, "chunk_size", r.args.chunk_size)
+            out = bytearray()
+            for i in range(0, len(body), size):
+                part = body[i:i + size]
+                out += b"%x\r\n" % len(part) + part + b"\r\n"
+            if not truncate:
+                out += b"0\r\n\r\n"
+            data = bytes(out)
+        else:
+            data = body
+
+        bandwidth = r.option(ep, "bandwidth", r.args.bandwidth)
+        try:
+            if bandwidth <= 0:
+                self.wfile.write(data)
+            else:
+                step = 512
+                for i in range(0, len(data), step):
+                    self.wfile.write(data[i:i + step])
+                    self.wfile.flush()
+                    time.sleep(min(step, len(data) - i) / float(bandwidth))
+            self.wfile.flush()
+        except (BrokenPipeError, ConnectionResetError):
+            self.close_connection = True
+        return len(data)
+
+    def log(self, ep, result, sent, start):
+        if self.replay.args.quiet:
+            return
+        print("REPLAY: %-13s %-8s %7d B %6.0f ms" % (
+            ep["name"] if ep else "?", result, sent,
+            (time.monotonic() - start) * 1000), file=sys.stderr)
+
+
+class Server(socketserver.ThreadingMixIn, socketserver.TCPServer):
+    allow_reuse_address = True
+    daemon_threads = True
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument("--manifest", default=DEFAULT_MANIFEST)
+    ap.add_argument("--host", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=8080)
+    ap.add_argument("--latency-ms", type=float, default=0,
+                    help="delay before the response headers")
+    ap.add_argument("--bandwidth", type=float, default=0,
+                    help="body bytes/s, 0 = unthrottled")
+    ap.add_argument("--error-rate", type=float, default=0,
+                    help="fraction of requests that fail (0..1)")
+    ap.add_argument("--error-kind", default="mixed",
+                    choices=ERRORS + ("mixed",))
+    ap.add_argument("--mode", default="length", choices=MODES,
+                    help="Content-Length, chunked, or HTTP/1.0 close-delimited")
+    ap.add_argument("--chunk-size", type=int, default=1024)
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("--record", action="store_true",
+                    help="proxy to the upstream APIs and save the responses")
+    ap.add_argument("--quiet", action="store_true")
+    args = ap.parse_args()
+
+    Handler.replay = Replay(args)
+    server = Server((args.host, args.port), Handler)
+    print("REPLAY: %d endpoints on %s:%d (%s%s)" % (
+        len(Handler.replay.endpoints), args.host, args.port,
+        "record" if args.record else args.mode,
+        ", %.0f ms, %.0f B/s, %.0f%% errors" % (
+            args.latency_ms, args.bandwidth, args.error_rate * 100)
+        if not args.record else ""), file=sys.stderr)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+// Host-side virtual-clock simulator for lib/FetchScheduler.
+//
+// Build & run (from the repo root):
+//   g++ -std=gnu++11 -O2 -Ilib/FetchScheduler -o scheduler_sim
+//       tools/scheduler_sim.cpp lib/FetchScheduler/FetchScheduler.cpp
+//   ./scheduler_sim --cities 3 --stops 2 --hours 24 --app bus
+//
+// Registers the same jobs/hosts as DataManager::networkTask and reports
+// fetches/hour per host and per job for the given configuration. A weather
+// fetch costs 3 HTTPS requests (forecast, AQI, current; geocoding is
+// cached), bus and stock fetches cost 1.
+
+#include "FetchScheduler.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Config {
+  int cities = 1;
+  int stops = 1;
+  bool stocks = true;
+  double hours = 24.0;
+  uint32_t latencyMs = 800; // Time a fetch keeps the network task busy
+  double failRate = 0.0;    // 0..1
+  const char *app = "weather"; // Visible app: weather | bus | stock | cycle
+  uint32_t cycleMs = 120000;   // App switch period for --app cycle
+};
+
+static void usage() {
+  printf("Options: --cities N --stops N --no-stocks --hours H --latency MS\n"
+         "         --fail RATE --app weather|bus|stock|cycle --cycle MS\n");
+}
+
+int main(int argc, char **argv) {
+  Config cfg;
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    const char *v = (i + 1 < argc) ? argv[i + 1] : "";
+    if (!strcmp(a, "--cities"))
+      cfg.cities = atoi(v), i++;
+    else if (!strcmp(a, "--stops"))
+      cfg.stops = atoi(v), i++;
+    else if (!strcmp(a, "--no-stocks"))
+      cfg.stocks = false;
+    else if (!strcmp(a, "--hours"))
+      cfg.hours = atof(v), i++;
+    else if (!strcmp(a, "--latency"))
+      cfg.latencyMs = atoi(v), i++;
+    else if (!strcmp(a, "--fail"))
+      cfg.failRate = atof(v), i++;
+    else if (!strcmp(a, "--app"))
+      cfg.app = v, i++;
+    else if (!strcmp(a, "--cycle"))
+      cfg.cycleMs = atoi(v), i++;
+    else {
+      usage();
+      return 1;
+    }
+  }
+
+  // Mirror of DataManager::networkTask registration
+  FetchScheduler sched;
+  int hostOwm = sched.addHost("api.openweathermap.org", 1000);
+  int hostTmb = sched.addHost("api.tmb.cat", 1000);
+  int hostYahoo = sched.addHost("query1.finance.yahoo.com", 1000);
+
+  std::vector<int> weatherJobs, busJobs;
+  for (int i = 0; i < cfg.cities; i++)
+    weatherJobs.push_back(sched.addJob("weather", hostOwm, 900000, 600000));
+  for (int i = 0; i < cfg.stops; i++)
+    busJobs.push_back(sched.addJob("bus", hostTmb, 60000, 60000));
+  int stockJob =
+      cfg.stocks ? sched.addJob("stock", hostYahoo, 300000, 300000) : -1;
+
+  std::vector<unsigned long> perJob(sched.jobCount(), 0);
+  std::vector<unsigned long> perHost(sched.hostCount(), 0);
+  std::vector<unsigned long> httpPerHost(sched.hostCount(), 0);
+  unsigned long wakeups = 0;
+
+  srand(1);
+  uint32_t now = 1; // millis() is never 0 after boot
+  const uint64_t endMs = (uint64_t)(cfg.hours * 3600000.0);
+  const char *apps[] = {"weather", "bus", "stock"};
+
+  while (now < endMs) {
+    // Which screen is visible right now?
+    const char *app = cfg.app;
+    if (!strcmp(app, "cycle"))
+      app = apps[(now / cfg.cycleMs) % 3];
+
+    for (size_t i = 0; i < weatherJobs.size(); i++)
+      sched.setActive(weatherJobs[i], !strcmp(app, "weather") && i == 0);
+    for (size_t i = 0; i < busJobs.size(); i++)
+      sched.setActive(busJobs[i], !strcmp(app, "bus") && i == 0);
+    sched.setActive(stockJob, !strcmp(app, "stock"));
+
+    int job = sched.next(now);
+    if (job >= 0) {
+      sched.begin(job, now);
+      now += cfg.latencyMs; // Fetch blocks the task
+      bool ok = (rand() / (double)RAND_MAX) >= cfg.failRate;
+      sched.complete(job, now, ok);
+      perJob[job]++;
+      perHost[sched.jobHost(job)]++;
+      httpPerHost[sched.jobHost(job)] += (sched.jobHost(job) == hostOwm) ? 3 : 1;
+      continue;
+    }
+
+    // Sleep until the earliest deadline (the device also wakes for UI
+    // triggers and the web server, which do not fetch by themselves)
+    uint32_t wait = sched.msUntilNext(now);
+    if (wait == 0 || wait == UINT32_MAX)
+      wait = 1000;
+    if (!strcmp(cfg.app, "cycle")) {
+      uint32_t toSwitch = cfg.cycleMs - (now % cfg.cycleMs);
+      if (toSwitch < wait)
+        wait = toSwitch;
+    }
+    now += wait;
+    wakeups++;
+  }
+
+  double hours = cfg.hours;
+  unsigned long total = 0, totalHttp = 0;
+  printf("Config: cities=%d stops=%d stocks=%s app=%s latency=%ums fail=%.2f "
+         "hours=%.1f\n",
+         cfg.cities, cfg.stops, cfg.stocks ? "yes" : "no", cfg.app,
+         cfg.latencyMs, cfg.failRate, hours);
+  printf("\nPer host:\n");
+  for (int h = 0; h < sched.hostCount(); h++) {
+    printf("  %-26s %8.1f fetch/h %8.1f req/h\n", sched.hostName(h),
+           perHost[h] / hours, httpPerHost[h] / hours);
+    total += perHost[h];
+    totalHttp += httpPerHost[h];
+  }
+  printf("\nPer job:\n");
+  for (int j = 0; j < sched.jobCount(); j++)
+    printf("  #%-2d %-8s %8.1f fetch/h\n", j, sched.jobName(j),
+           perJob[j] / hours);
+  printf("\nTotal: %.1f fetch/h, %.1f HTTPS req/h, %.1f idle wakeups/h\n",
+         total / hours, totalHttp / hours, wakeups / hours);
+  return 0;
+}
@@ -0,0 +1,150 @@
+// Host benchmark: UTF-8 name transliteration, sequential replaces vs. the
+// single-pass table (lib/Translit).
+//
+// Runs every name in a list (default: tools/payloads/tmb_names.txt, real TMB
+// stop and destination names) through
+//   a) the previous path: the BusService sanitize() at ingest plus
+//      GuiController::sanitize() on every render, each ~26 whole-string
+//      replace passes (std::string stand-in for Arduino String::replace)
+//   b) Translit::apply() once at ingest, into a caller buffer
+//   c) Translit::forDisplay(): glyph-coverage pass, UTF-8 kept when the
+//      name fonts cover it (the ingest path; add -DNAME_FONTS to measure
+//      it with the subset fonts, otherwise it folds like b)
+// and reports ns per name, plus any names where the outputs differ.
+//
+// Build:
+//   g++ -std=gnu++11 -O2 [-DNAME_FONTS] -Ilib/Translit -o translit_bench
+//       tools/translit_bench.cpp lib/Translit/Translit.cpp
+//   ./translit_bench tools/payloads/tmb_names.txt [iterations] [renders]
+
+#include "Translit.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+static void replaceAll(std::string &s, const char *from, const char *to) {
+  size_t fromLen = strlen(from), toLen = strlen(to);
+  size_t pos = 0;
+  while ((pos = s.find(from, pos)) != std::string::npos) {
+    s.replace(pos, fromLen, to);
+    pos += toLen;
+  }
+}
+
+// Old BusService.cpp sanitize()
+static std::string sanitizeIngest(std::string s) {
+  static const char *map[][2] = {
+      {"á", "a"}, {"à", "a"}, {"Á", "A"}, {"À", "A"}, {"é", "e"}, {"è", "e"},
+      {"É", "E"}, {"È", "E"}, {"í", "i"}, {"Í", "I"}, {"ï", "i"}, {"Ï", "I"},
+      {"ó", "o"}, {"ò", "o"}, {"Ó", "O"}, {"Ò", "O"}, {"ú", "u"}, {"ù", "u"},
+      {"ü", "u"}, {"Ú", "U"}, {"Ü", "U"}, {"ñ", "n"}, {"Ñ", "N"}, {"ç", "c"},
+      {"Ç", "C"}, {"·", "."}};
+  for (auto &m : map)
+    replaceAll(s, m[0], m[1]);
+  return s;
+}
+
+// Old GuiController::sanitize()
+static std::string sanitizeRender(std::string s) {
+  static const char *map[][2] = {
+      {"ç", "c"}, {"Ç", "C"}, {"ñ", "n"}, {"Ñ", "N"}, {"à", "a"}, {"á", "a"},
+      {"À", "A"}, {"Á", "A"}, {"è", "e"}, {"é", "e"}, {"È", "E"}, {"É", "E"},
+      {"í", "i"}, {"ï", "i"}, {"Í", "I"}, {"Ï", "I"}, {"ò", "o"}, {"ó", "o"},
+      {"Ò", "O"}, {"Ó", "O"}, {"ú", "u"}, {"ü", "u"}, {"Ú", "U"}, {"Ü", "U"}};
+  for (auto &m : map)
+    replaceAll(s, m[0], m[1]);
+  return s;
+}
+
+int main(int argc, char **argv) {
+  const char *path = argc > 1 ? argv[1] : "tools/payloads/tmb_names.txt";
+  int iterations = argc > 2 ? atoi(argv[2]) : 2000;
+  int renders = argc > 3 ? atoi(argv[3]) : 10; // Redraws per ingest (old)
+
+  std::ifstream f(path);
+  if (!f) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    return 1;
+  }
+  std::vector<std::string> names;
+  std::string line;
+  size_t bytes = 0;
+  while (std::getline(f, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+    names.push_back(line);
+    bytes += line.size();
+  }
+  printf("%zu names, %zu bytes, %d iterations, %d renders per ingest\n",
+         names.size(), bytes, iterations, renders);
+
+  // Correctness: new output vs. old ingest + render pipeline
+  int diffs = 0;
+  for (const std::string &n : names) {
+    char buf[128];
+    Translit::apply(n.c_str(), buf, sizeof(buf));
+    std::string old = sanitizeRender(sanitizeIngest(n));
+    if (old != buf) {
+      printf("  differs: \"%s\" old \"%s\" new \"%s\"\n", n.c_str(),
+             old.c_str(), buf);
+      diffs++;
+    }
+  }
+
+  typedef std::chrono::steady_clock clk;
+  volatile size_t sink = 0;
+
+  clk::time_point t0 = clk::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const std::string &n : names) {
+      std::string s = sanitizeIngest(n);
+      for (int r = 0; r < renders; r++)
+        sink += sanitizeRender(s).size();
+    }
+  }
+  double oldNs = std::chrono::duration<double, std::nano>(clk::now() - t0)
+                     .count() /
+                 ((double)iterations * names.size());
+
+  t0 = clk::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const std::string &n : names) {
+      char buf[128];
+      sink += Translit::apply(n.c_str(), buf, sizeof(buf));
+    }
+  }
+  double newNs = std::chrono::duration<double, std::nano>(clk::now() - t0)
+                     .count() /
+                 ((double)iterations * names.size());
+
+  int kept = 0;
+  t0 = clk::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const std::string &n : names) {
+      char buf[128];
+      size_t len = Translit::forDisplay(n.c_str(), buf, sizeof(buf));
+      if (it == 0 && len == n.size())
+        kept++;
+      sink += len;
+    }
+  }
+  double dispNs = std::chrono::duration<double, std::nano>(clk::now() - t0)
+                      .count() /
+                  ((double)iterations * names.size());
+
+  printf("replace passes (ingest + %d renders): %9.0f ns/name\n", renders,
+         oldNs);
+  printf("single pass (ingest only):             %9.0f ns/name (%.0fx)\n",
+         newNs, oldNs / newNs);
+  printf("coverage pass (ingest only):           %9.0f ns/name, %d/%zu kept "
+         "as UTF-8\n",
+         dispNs, kept, names.size());
+  printf("output differences: %d\n", diffs);
+  (void)sink;
+  return 0;
+}